@@ -82,6 +82,7 @@ HEADERS += \
 		src/net/servergamestate.h \
 		src/net/serverlobbythread.h \
 		src/net/serverbanmanager.h \
+		src/net/serverconnectlimiter.h \
 		src/net/servercallback.h \
 		src/net/serveradminbot.h \
 		src/net/serverlobbybot.h \
@@ -89,6 +90,9 @@ HEADERS += \
 		src/net/sessiondata.h \
 		src/net/sessiondatacallback.h \
 		src/net/sessionmanager.h \
+		src/net/sessiontimerwheel.h \
+		src/net/gametimerwheel.h \
+		src/net/spectatorfeed.h \
 		src/net/socket_helper.h \
 		src/net/socket_msg.h \
 		src/net/socket_startup.h \
@@ -193,6 +197,7 @@ SOURCES += \
 		src/net/common/servergamestate.cpp \
 		src/net/common/serverlobbythread.cpp \
 		src/net/common/serverbanmanager.cpp \
+		src/net/common/serverconnectlimiter.cpp \
 		src/net/common/servercallback.cpp \
 		src/net/common/serveradminbot.cpp \
 		src/net/common/serverlobbybot.cpp \
@@ -200,6 +205,9 @@ SOURCES += \
 		src/net/common/sessiondata.cpp \
 		src/net/common/sessiondatacallback.cpp \
 		src/net/common/sessionmanager.cpp \
+		src/net/common/sessiontimerwheel.cpp \
+		src/net/common/gametimerwheel.cpp \
+		src/net/common/spectatorfeed.cpp \
 		src/net/common/socket_startup.cpp \
 		src/net/common/clientexception.cpp \
 		src/net/common/netcontext.cpp \
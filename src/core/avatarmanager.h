@@ -47,7 +47,9 @@
 #define MAX_AVATAR_FILE_SIZE	30720
 
 struct AvatarFileState;
+struct MappedAvatarFile;
 class UploaderThread;
+class AvatarCleanupThread;
 
 class AvatarManager
 {
@@ -64,7 +66,10 @@ public:
 	static boost::shared_ptr<AvatarFileState> OpenAvatarFileForChunkRead(const std::string &fileName, unsigned &outFileSize, AvatarFileType &outFileType);
 	static unsigned ChunkReadAvatarFile(boost::shared_ptr<AvatarFileState> fileState, unsigned char *data, unsigned chunkSize);
 
-	static int AvatarFileToNetPackets(const std::string &fileName, unsigned requestId, NetPacketList &packets);
+	// The file is mapped once and split into data packets of chunkSize bytes.
+	static int AvatarFileToNetPackets(const std::string &fileName, unsigned requestId, NetPacketList &packets, unsigned chunkSize = MAX_FILE_DATA_SIZE);
+	// Same as above, but serves the data from the mapped avatar cache.
+	int AvatarToNetPackets(const MD5Buf &md5buf, unsigned requestId, NetPacketList &packets, unsigned chunkSize = MAX_FILE_DATA_SIZE);
 	static AvatarFileType GetAvatarFileType(const std::string &fileName);
 	static std::string GetAvatarFileExtension(AvatarFileType fileType);
 
@@ -75,14 +80,23 @@ public:
 
 	static bool IsValidAvatarFileType(AvatarFileType avatarFileType, const unsigned char *fileHeader, size_t fileHeaderSize);
 
+	// Starts removing old cache entries in the background.
 	void RemoveOldAvatarCacheEntries();
 
 protected:
 	typedef std::map<MD5Buf, std::string> AvatarMap;
 	typedef std::list<MD5Buf> AvatarList;
-	typedef std::map<std::time_t, MD5Buf> TimeAvatarMap;
+	typedef std::multimap<std::time_t, MD5Buf> TimeAvatarMap;
+
+	typedef std::map<MD5Buf, boost::shared_ptr<MappedAvatarFile> > MappedAvatarMap;
 
 	bool InternalReadDirectory(const std::string &dir, AvatarMap &avatars);
+	boost::shared_ptr<MappedAvatarFile> GetMappedAvatar(const MD5Buf &md5buf);
+	void RemoveMappedAvatar(const MD5Buf &md5buf);
+	static boost::shared_ptr<MappedAvatarFile> MapAvatarFile(const std::string &fileName);
+	// Returns false if the cleanup thread was terminated while collecting.
+	bool InternalCollectOldAvatarCacheEntries(AvatarCleanupThread &cleanupThread, AvatarList &outDeleteList);
+	void InternalDeleteAvatarCacheEntries(AvatarList &deleteList, unsigned maxNumEntries);
 
 private:
 	mutable boost::mutex	m_avatarsMutex;
@@ -91,6 +105,11 @@ private:
 	mutable boost::mutex	m_cachedAvatarsMutex;
 	AvatarMap				m_cachedAvatars;
 
+	mutable boost::mutex	m_mappedAvatarsMutex;
+	MappedAvatarMap			m_mappedAvatars;
+	AvatarList				m_mappedAvatarsLru;
+	size_t					m_mappedAvatarsBytes;
+
 	mutable boost::mutex	m_cacheDirMutex;
 	std::string				m_cacheDir;
 
@@ -100,6 +119,11 @@ private:
 	const std::string		m_externalServerPassword;
 
 	boost::shared_ptr<UploaderThread> m_uploader;
+
+	mutable boost::mutex	m_cleanupMutex;
+	boost::shared_ptr<AvatarCleanupThread> m_cleanupThread;
+
+	friend class AvatarCleanupThread;
 };
 
 #endif
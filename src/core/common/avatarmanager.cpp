@@ -33,10 +33,12 @@
 #include <net/net_helper.h>
 #include <net/socket_msg.h>
 #include <net/uploaderthread.h>
+#include <core/thread.h>
 #include <core/loghelper.h>
 #include <core/crypthelper.h>
 
 #include <boost/filesystem.hpp>
+#include <boost/iostreams/device/mapped_file.hpp>
 #include <boost/lambda/lambda.hpp>
 #include <boost/algorithm/string/predicate.hpp>
 #include <core/openssl_wrapper.h>
@@ -46,6 +48,11 @@
 
 #define MAX_NUMBER_OF_FILES			NetHelper::GetMaxNumberOfAvatarFiles()
 #define MAX_AVATAR_CACHE_AGE		NetHelper::GetMaxAvatarCacheAgeSec()
+#define MAX_MAPPED_AVATAR_BYTES		(4 * 1024 * 1024)
+// Each mapping keeps a file descriptor open.
+#define MAX_MAPPED_AVATAR_FILES		128
+#define CLEANUP_SLICE_NUM_FILES		16
+#define CLEANUP_SLICE_DELAY_MSEC	50
 
 #define PNG_HEADER "\x89\x50\x4e\x47\x0d\x0a\x1a\x0a"
 #define PNG_HEADER_SIZE (sizeof(PNG_HEADER) - 1)
@@ -64,9 +71,78 @@ struct AvatarFileState {
 	ifstream		inputStream;
 };
 
+class AvatarCleanupThread : public Thread
+{
+public:
+	AvatarCleanupThread(AvatarManager &manager) : m_manager(manager), m_terminating(false) {}
+
+	// ShouldTerminate() returns true only once, so remember the result.
+	bool IsTerminating()
+	{
+		if (!m_terminating)
+			m_terminating = ShouldTerminate();
+		return m_terminating;
+	}
+
+protected:
+	virtual void Main()
+	{
+		AvatarManager::AvatarList deleteList;
+		if (!m_manager.InternalCollectOldAvatarCacheEntries(*this, deleteList))
+			return;
+		// Delete in small slices to keep the disk load low.
+		while (!deleteList.empty() && !IsTerminating()) {
+			m_manager.InternalDeleteAvatarCacheEntries(deleteList, CLEANUP_SLICE_NUM_FILES);
+			Msleep(CLEANUP_SLICE_DELAY_MSEC);
+		}
+	}
+
+private:
+	AvatarManager &m_manager;
+	bool m_terminating;
+};
+
+struct MappedAvatarFile {
+	boost::iostreams::mapped_file_source	file;
+	AvatarFileType							fileType;
+	size_t									mappedBytes;
+	list<MD5Buf>::iterator					lruPos;
+};
+
+static void
+AvatarDataToNetPackets(AvatarFileType fileType, const unsigned char *fileData, size_t fileSize, unsigned requestId, NetPacketList &packets, unsigned chunkSize)
+{
+	boost::shared_ptr<NetPacket> avatarHeader(new NetPacket);
+	avatarHeader->GetMsg()->set_messagetype(PokerTHMessage::Type_AvatarHeaderMessage);
+	AvatarHeaderMessage *netHeader = avatarHeader->GetMsg()->mutable_avatarheadermessage();
+	netHeader->set_requestid(requestId);
+	netHeader->set_avatartype(static_cast<NetAvatarType>(fileType));
+	netHeader->set_avatarsize(static_cast<unsigned>(fileSize));
+	packets.push_back(avatarHeader);
+
+	// Copy the data blocks directly from the mapped file.
+	size_t pos = 0;
+	while (pos < fileSize) {
+		size_t numBytes = min(fileSize - pos, static_cast<size_t>(chunkSize));
+		boost::shared_ptr<NetPacket> avatarFile(new NetPacket);
+		avatarFile->GetMsg()->set_messagetype(PokerTHMessage::Type_AvatarDataMessage);
+		AvatarDataMessage *netFile = avatarFile->GetMsg()->mutable_avatardatamessage();
+		netFile->set_requestid(requestId);
+		netFile->set_avatarblock((const char *)&fileData[pos], numBytes);
+		packets.push_back(avatarFile);
+		pos += numBytes;
+	}
+
+	boost::shared_ptr<NetPacket> avatarEnd(new NetPacket);
+	avatarEnd->GetMsg()->set_messagetype(PokerTHMessage::Type_AvatarEndMessage);
+	AvatarEndMessage *netEnd = avatarEnd->GetMsg()->mutable_avatarendmessage();
+	netEnd->set_requestid(requestId);
+	packets.push_back(avatarEnd);
+}
+
 AvatarManager::AvatarManager(bool useExternalServer, const std::string &externalServerAddress,
 							 const string &externalServerUser, const string &externalServerPassword)
-	: m_useExternalServer(useExternalServer), m_externalServerAddress(externalServerAddress),
+	: m_mappedAvatarsBytes(0), m_useExternalServer(useExternalServer), m_externalServerAddress(externalServerAddress),
 	  m_externalServerUser(externalServerUser), m_externalServerPassword(externalServerPassword)
 {
 	m_uploader.reset(new UploaderThread());
@@ -74,6 +150,13 @@ AvatarManager::AvatarManager(bool useExternalServer, const std::string &external
 
 AvatarManager::~AvatarManager()
 {
+	{
+		boost::mutex::scoped_lock lock(m_cleanupMutex);
+		if (m_cleanupThread) {
+			m_cleanupThread->SignalTermination();
+			m_cleanupThread->Join(THREAD_WAIT_INFINITE);
+		}
+	}
 	m_uploader->SignalTermination();
 	m_uploader->Join(UPLOADER_THREAD_TERMINATE_TIMEOUT);
 }
@@ -188,48 +271,26 @@ AvatarManager::ChunkReadAvatarFile(boost::shared_ptr<AvatarFileState> fileState,
 }
 
 int
-AvatarManager::AvatarFileToNetPackets(const string &fileName, unsigned requestId, NetPacketList &packets)
+AvatarManager::AvatarFileToNetPackets(const string &fileName, unsigned requestId, NetPacketList &packets, unsigned chunkSize)
 {
 	int retVal = ERR_NET_INVALID_AVATAR_FILE;
-	unsigned fileSize = 0;
-	AvatarFileType fileType;
-	boost::shared_ptr<AvatarFileState> tmpState = OpenAvatarFileForChunkRead(fileName, fileSize, fileType);
-	if (tmpState.get() && fileSize && fileType != AVATAR_FILE_TYPE_UNKNOWN) {
-		boost::shared_ptr<NetPacket> avatarHeader(new NetPacket);
-		avatarHeader->GetMsg()->set_messagetype(PokerTHMessage::Type_AvatarHeaderMessage);
-		AvatarHeaderMessage *netHeader = avatarHeader->GetMsg()->mutable_avatarheadermessage();
-		netHeader->set_requestid(requestId);
-		netHeader->set_avatartype(static_cast<NetAvatarType>(fileType));
-		netHeader->set_avatarsize(fileSize);
-		packets.push_back(avatarHeader);
-
-		unsigned numBytes = 0;
-		unsigned totalBytesRead = 0;
-		vector<unsigned char> tmpData(MAX_FILE_DATA_SIZE);
-		do {
-			numBytes = ChunkReadAvatarFile(tmpState, &tmpData[0], MAX_FILE_DATA_SIZE);
-			if (numBytes) {
-				totalBytesRead += numBytes;
-
-				boost::shared_ptr<NetPacket> avatarFile(new NetPacket);
-				avatarFile->GetMsg()->set_messagetype(PokerTHMessage::Type_AvatarDataMessage);
-				AvatarDataMessage *netFile = avatarFile->GetMsg()->mutable_avatardatamessage();
-				netFile->set_requestid(requestId);
-				netFile->set_avatarblock((const char *)&tmpData[0], numBytes);
-				packets.push_back(avatarFile);
-			}
-		} while (numBytes);
-
-		if (fileSize != totalBytesRead)
-			retVal = ERR_NET_WRONG_AVATAR_SIZE;
-		else {
-			boost::shared_ptr<NetPacket> avatarEnd(new NetPacket);
-			avatarEnd->GetMsg()->set_messagetype(PokerTHMessage::Type_AvatarEndMessage);
-			AvatarEndMessage *netEnd = avatarEnd->GetMsg()->mutable_avatarendmessage();
-			netEnd->set_requestid(requestId);
-			packets.push_back(avatarEnd);
-			retVal = 0;
-		}
+	boost::shared_ptr<MappedAvatarFile> mappedFile(MapAvatarFile(fileName));
+	if (mappedFile) {
+		AvatarDataToNetPackets(mappedFile->fileType, (const unsigned char *)mappedFile->file.data(), mappedFile->file.size(), requestId, packets, chunkSize);
+		retVal = 0;
+	}
+	return retVal;
+}
+
+int
+AvatarManager::AvatarToNetPackets(const MD5Buf &md5buf, unsigned requestId, NetPacketList &packets, unsigned chunkSize)
+{
+	int retVal = ERR_NET_INVALID_AVATAR_FILE;
+	// The shared pointer keeps the mapping valid even if it is evicted meanwhile.
+	boost::shared_ptr<MappedAvatarFile> mappedFile(GetMappedAvatar(md5buf));
+	if (mappedFile) {
+		AvatarDataToNetPackets(mappedFile->fileType, (const unsigned char *)mappedFile->file.data(), mappedFile->file.size(), requestId, packets, chunkSize);
+		retVal = 0;
 	}
 	return retVal;
 }
@@ -418,6 +479,20 @@ AvatarManager::IsValidAvatarFileType(AvatarFileType avatarFileType, const unsign
 
 void
 AvatarManager::RemoveOldAvatarCacheEntries()
+{
+	// The cleanup is performed in the background, in small slices.
+	boost::mutex::scoped_lock lock(m_cleanupMutex);
+	// Start a new cleanup if the previous one has finished.
+	if (m_cleanupThread && m_cleanupThread->Join(0))
+		m_cleanupThread.reset();
+	if (!m_cleanupThread) {
+		m_cleanupThread.reset(new AvatarCleanupThread(*this));
+		m_cleanupThread->Run();
+	}
+}
+
+bool
+AvatarManager::InternalCollectOldAvatarCacheEntries(AvatarCleanupThread &cleanupThread, AvatarList &outDeleteList)
 {
 	string cacheDir;
 	{
@@ -429,16 +504,24 @@ AvatarManager::RemoveOldAvatarCacheEntries()
 		cacheDir = cachePath.directory_string();
 		// Never delete anything if we do not have a special cache dir set.
 		if (!cacheDir.empty()) {
-			boost::mutex::scoped_lock lock(m_cachedAvatarsMutex);
+			// Work on a copy, so that the file system is not accessed while locked.
+			AvatarMap cachedAvatars;
+			{
+				boost::mutex::scoped_lock lock(m_cachedAvatarsMutex);
+				cachedAvatars = m_cachedAvatars;
+			}
 
 			// First pass: Remove files which no longer exist.
 			// Count files and record age.
 			AvatarList removeList;
 			TimeAvatarMap timeMap;
 			{
-				AvatarMap::const_iterator i = m_cachedAvatars.begin();
-				AvatarMap::const_iterator end = m_cachedAvatars.end();
+				AvatarMap::const_iterator i = cachedAvatars.begin();
+				AvatarMap::const_iterator end = cachedAvatars.end();
 				while (i != end) {
+					// Checking the files may take a while, stop if requested.
+					if (cleanupThread.IsTerminating())
+						return false;
 					bool keepFile = false;
 					path filePath(i->second);
 					string fileString(filePath.file_string());
@@ -459,52 +542,75 @@ AvatarManager::RemoveOldAvatarCacheEntries()
 			}
 
 			{
+				boost::mutex::scoped_lock lock(m_cachedAvatarsMutex);
 				AvatarList::const_iterator i = removeList.begin();
 				AvatarList::const_iterator end = removeList.end();
 				while (i != end) {
+					RemoveMappedAvatar(*i);
 					m_cachedAvatars.erase(*i);
 					++i;
 				}
-				removeList.clear();
 			}
 
-			// Remove and physically delete files in one of the
+			// Collect files for physical deletion in one of the
 			// following cases:
 			// 1. More than MAX_NUMBER_OF_FILES files are present
 			//    - delete until only MAX_NUMBER_OF_FILES/2 are left.
 			// 2. Files are older than 30 days.
+			// The time map is ordered, so the oldest files are deleted first.
 
-			if (m_cachedAvatars.size() > MAX_NUMBER_OF_FILES) {
-				while (!timeMap.empty() && m_cachedAvatars.size() > MAX_NUMBER_OF_FILES / 2) {
+			size_t numFiles = timeMap.size();
+			if (numFiles > MAX_NUMBER_OF_FILES) {
+				while (!timeMap.empty() && numFiles > MAX_NUMBER_OF_FILES / 2) {
 					TimeAvatarMap::iterator i = timeMap.begin();
-					AvatarMap::iterator pos = m_cachedAvatars.find(i->second);
-					if (pos != m_cachedAvatars.end()) {
-						path tmpPath(pos->second);
-						remove(tmpPath);
-						m_cachedAvatars.erase(pos);
-					}
+					outDeleteList.push_back(i->second);
+					numFiles--;
 					timeMap.erase(i);
 				}
 			}
 
 			// Get reference time.
 			time_t curTime = time(NULL);
-			while (!timeMap.empty() && !m_cachedAvatars.empty()) {
+			while (!timeMap.empty()) {
 				TimeAvatarMap::iterator i = timeMap.begin();
 				if (curTime - i->first < (int)MAX_AVATAR_CACHE_AGE)
 					break;
-				AvatarMap::iterator pos = m_cachedAvatars.find(i->second);
-				if (pos != m_cachedAvatars.end()) {
-					path tmpPath(pos->second);
-					remove(tmpPath);
-					m_cachedAvatars.erase(pos);
-				}
+				outDeleteList.push_back(i->second);
 				timeMap.erase(i);
 			}
 		}
 	} catch (...) {
 		LOG_ERROR("Exception caught while cleaning up cache.");
 	}
+	return true;
+}
+
+void
+AvatarManager::InternalDeleteAvatarCacheEntries(AvatarList &deleteList, unsigned maxNumEntries)
+{
+	unsigned numEntries = 0;
+	while (!deleteList.empty() && numEntries < maxNumEntries) {
+		string fileName;
+		{
+			boost::mutex::scoped_lock lock(m_cachedAvatarsMutex);
+			AvatarMap::iterator pos = m_cachedAvatars.find(deleteList.front());
+			if (pos != m_cachedAvatars.end()) {
+				fileName = pos->second;
+				m_cachedAvatars.erase(pos);
+			}
+		}
+		if (!fileName.empty()) {
+			RemoveMappedAvatar(deleteList.front());
+			try {
+				path tmpPath(fileName);
+				remove(tmpPath);
+			} catch (...) {
+				LOG_ERROR("Exception caught while deleting cached avatar.");
+			}
+		}
+		deleteList.pop_front();
+		numEntries++;
+	}
 }
 
 bool
@@ -542,3 +648,79 @@ AvatarManager::InternalReadDirectory(const std::string &dir, AvatarMap &avatars)
 	return retVal;
 }
 
+boost::shared_ptr<MappedAvatarFile>
+AvatarManager::GetMappedAvatar(const MD5Buf &md5buf)
+{
+	boost::shared_ptr<MappedAvatarFile> retVal;
+	{
+		boost::mutex::scoped_lock lock(m_mappedAvatarsMutex);
+		MappedAvatarMap::iterator pos = m_mappedAvatars.find(md5buf);
+		if (pos != m_mappedAvatars.end()) {
+			// Move to the front of the LRU list.
+			m_mappedAvatarsLru.splice(m_mappedAvatarsLru.begin(), m_mappedAvatarsLru, pos->second->lruPos);
+			retVal = pos->second;
+		}
+	}
+	string fileName;
+	if (!retVal && GetAvatarFileName(md5buf, fileName)) {
+		// Map the file without holding the lock.
+		boost::shared_ptr<MappedAvatarFile> mappedFile(MapAvatarFile(fileName));
+		if (mappedFile) {
+			boost::mutex::scoped_lock lock(m_mappedAvatarsMutex);
+			MappedAvatarMap::iterator pos = m_mappedAvatars.find(md5buf);
+			if (pos != m_mappedAvatars.end())
+				retVal = pos->second;
+			else {
+				m_mappedAvatarsLru.push_front(md5buf);
+				mappedFile->lruPos = m_mappedAvatarsLru.begin();
+				m_mappedAvatars.insert(MappedAvatarMap::value_type(md5buf, mappedFile));
+				m_mappedAvatarsBytes += mappedFile->mappedBytes;
+				retVal = mappedFile;
+
+				// Unmap the least recently used avatars if a limit is exceeded.
+				while ((m_mappedAvatarsBytes > MAX_MAPPED_AVATAR_BYTES || m_mappedAvatarsLru.size() > MAX_MAPPED_AVATAR_FILES)
+						&& m_mappedAvatarsLru.size() > 1) {
+					MappedAvatarMap::iterator oldest = m_mappedAvatars.find(m_mappedAvatarsLru.back());
+					m_mappedAvatarsBytes -= oldest->second->mappedBytes;
+					m_mappedAvatars.erase(oldest);
+					m_mappedAvatarsLru.pop_back();
+				}
+			}
+		}
+	}
+	return retVal;
+}
+
+void
+AvatarManager::RemoveMappedAvatar(const MD5Buf &md5buf)
+{
+	boost::mutex::scoped_lock lock(m_mappedAvatarsMutex);
+	MappedAvatarMap::iterator pos = m_mappedAvatars.find(md5buf);
+	if (pos != m_mappedAvatars.end()) {
+		m_mappedAvatarsBytes -= pos->second->mappedBytes;
+		m_mappedAvatarsLru.erase(pos->second->lruPos);
+		m_mappedAvatars.erase(pos);
+	}
+}
+
+boost::shared_ptr<MappedAvatarFile>
+AvatarManager::MapAvatarFile(const std::string &fileName)
+{
+	boost::shared_ptr<MappedAvatarFile> retVal;
+	try {
+		boost::shared_ptr<MappedAvatarFile> mappedFile(new MappedAvatarFile);
+		mappedFile->fileType = GetAvatarFileType(fileName);
+		mappedFile->file.open(fileName);
+		size_t fileSize = mappedFile->file.size();
+		// Mappings occupy whole pages.
+		size_t pageSize = boost::iostreams::mapped_file_source::alignment();
+		mappedFile->mappedBytes = (fileSize + pageSize - 1) / pageSize * pageSize;
+		if (fileSize >= MIN_AVATAR_FILE_SIZE && fileSize <= MAX_AVATAR_FILE_SIZE
+				&& IsValidAvatarFileType(mappedFile->fileType, (const unsigned char *)mappedFile->file.data(), fileSize)) {
+			retVal = mappedFile;
+		}
+	} catch (const exception &e) {
+		LOG_ERROR("Exception caught when trying to map avatar: " << e.what());
+	}
+	return retVal;
+}
@@ -35,6 +35,8 @@
 #include <cstring>
 #include <cstdio>
 
+#define MD5_READ_BUF_SIZE	8192
+
 using namespace std;
 
 // Helper function.
@@ -177,20 +179,20 @@ CryptHelper::MD5Sum(const std::string &fileName, MD5Buf &buf)
 
 	if (file) {
 		// Calculate MD5 sum of file.
-		unsigned char *readBuf = new unsigned char[8192];
+		unsigned char *readBuf = new unsigned char[MD5_READ_BUF_SIZE];
 		size_t numBytes;
 
 #ifdef HAVE_OPENSSL
 		MD5_CTX context;
 		MD5_Init(&context);
-		while ((numBytes = fread(readBuf, 1, sizeof(readBuf), file)) > 0) {
+		while ((numBytes = fread(readBuf, 1, MD5_READ_BUF_SIZE, file)) > 0) {
 			MD5_Update(&context, readBuf, numBytes);
 		}
 		MD5_Final(buf.GetData(), &context);
 #else
 		gcry_md_hd_t hash;
 		gcry_md_open(&hash, GCRY_MD_MD5, 0);
-		while ((numBytes = fread(readBuf, 1, sizeof(readBuf), file)) > 0) {
+		while ((numBytes = fread(readBuf, 1, MD5_READ_BUF_SIZE, file)) > 0) {
 			gcry_md_write(hash, readBuf, numBytes);
 		}
 		memcpy(buf.GetData(), gcry_md_read(hash, GCRY_MD_MD5), MD5_DATA_SIZE);
@@ -34,14 +34,15 @@
 #define _ASIORECEIVEBUFFER_H_
 
 #include <net/receivebuffer.h>
+#include <vector>
 
-// MUST be larger than MAX_PACKET_SIZE
-#define RECV_BUF_SIZE		5 * MAX_PACKET_SIZE
+// Number of maximum sized packets which fit into the receive buffer.
+#define RECV_BUF_NUM_PACKETS	5
 
 class AsioReceiveBuffer : public ReceiveBuffer
 {
 public:
-	AsioReceiveBuffer();
+	AsioReceiveBuffer(size_t maxSize = MAX_PACKET_SIZE);
 
 	virtual void StartAsyncRead(boost::shared_ptr<SessionData> session);
 	virtual void HandleRead(boost::shared_ptr<SessionData> session, const boost::system::error_code &error, size_t bytesRead);
@@ -50,13 +51,15 @@ public:
 protected:
 
 	void ScanPackets(boost::shared_ptr<SessionData> session);
+	void AddReceivedPacket(boost::shared_ptr<SessionData> session, boost::shared_ptr<NetPacket> packet);
 	void ProcessPackets(boost::shared_ptr<SessionData> session);
 
 
 private:
 	NetPacketList					receivedPackets;
-	char							recvBuf[RECV_BUF_SIZE];
+	std::vector<char>				recvBuf;
 	size_t							recvBufUsed;
+	const size_t					maxPacketSize;
 };
 
 #endif
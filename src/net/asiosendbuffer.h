@@ -35,10 +35,11 @@
 
 #include <net/sendbuffer.h>
 #include <cstdlib>
+#include <map>
 
 
 #define SEND_BUF_FIRST_ALLOC_CHUNKSIZE		4096
-#define MAX_SEND_BUF_SIZE					SEND_BUF_FIRST_ALLOC_CHUNKSIZE * 256
+#define MAX_SEND_BUF_SIZE					SEND_QUEUE_HARD_LIMIT
 
 
 class AsioSendBuffer : public SendBuffer
@@ -82,19 +83,31 @@ public:
 
 	virtual void AsyncSendNextPacket(boost::shared_ptr<SessionData> session);
 	void AsyncSendNextPacket(boost::shared_ptr<boost::asio::ip::tcp::socket> socket);
-	virtual void InternalStorePacket(boost::shared_ptr<SessionData> session, boost::shared_ptr<NetPacket> packet);
+	virtual StoreResult InternalStorePacket(boost::shared_ptr<SessionData> session, boost::shared_ptr<NetPacket> packet);
+	virtual StoreResult InternalStoreEncodedPacket(boost::shared_ptr<SessionData> session, boost::shared_ptr<NetPacket> packet, const std::string &encodedData);
+	virtual bool IsCongested(boost::shared_ptr<SessionData> session) const;
 	int EncodeToBuf(const void *data, size_t size);
+	int EncodePacket(const NetPacket &packet);
 
 	virtual void HandleWrite(boost::shared_ptr<boost::asio::ip::tcp::socket> socket, const boost::system::error_code &error);
 
+protected:
+	typedef std::map<std::pair<int, unsigned>, boost::shared_ptr<NetPacket> > DroppablePacketMap;
+
+	StoreResult InternalStore(boost::shared_ptr<SessionData> session, boost::shared_ptr<NetPacket> packet, const std::string *encodedData);
+	void StoreDroppablePackets();
+
 private:
+	DroppablePacketMap droppablePackets;
 	char *sendBuf;
 	char *curWriteBuf;
 	size_t sendBufAllocated;
 	size_t sendBufUsed;
 	size_t curWriteBufAllocated;
 	size_t curWriteBufUsed;
+	unsigned sendBufNumPackets;
 	bool closeAfterSend;
+	bool overflow;
 };
 
 #endif
@@ -46,6 +46,7 @@ class ClientCallback;
 class Game;
 class NetPacket;
 class DownloadHelper;
+class GameListNewMessage;
 
 class ClientState
 {
@@ -230,6 +231,7 @@ protected:
 	AbstractClientStateReceiving();
 
 	virtual void InternalHandlePacket(boost::shared_ptr<ClientThread> client, boost::shared_ptr<NetPacket> tmpPacket) = 0;
+	static void HandleGameListNew(boost::shared_ptr<ClientThread> client, const GameListNewMessage &netListNew);
 };
 
 // State: Session init.
@@ -135,6 +135,7 @@ public:
 	virtual void SessionError(boost::shared_ptr<SessionData> /*session*/, int /*errorCode*/) {}
 	virtual void SessionTimeoutWarning(boost::shared_ptr<SessionData> /*session*/, unsigned /*remainingSec*/) {}
 	virtual void HandlePacket(boost::shared_ptr<SessionData> session, boost::shared_ptr<NetPacket> packet);
+	virtual void HandlePacketBatch(boost::shared_ptr<SessionData> session, const std::list<boost::shared_ptr<NetPacket> > &packetList);
 
 	void SelectServer(unsigned serverId);
 	void SetLogin(const std::string &userName, const std::string &password, bool isGuest);
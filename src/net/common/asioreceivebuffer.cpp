@@ -31,6 +31,7 @@
 
 #include <boost/asio.hpp>
 #include <boost/bind.hpp>
+#include <boost/foreach.hpp>
 
 #include <net/asioreceivebuffer.h>
 #include <net/sessiondata.h>
@@ -39,17 +40,16 @@
 
 using namespace std;
 
-AsioReceiveBuffer::AsioReceiveBuffer()
-	: recvBufUsed(0)
+AsioReceiveBuffer::AsioReceiveBuffer(size_t maxSize)
+	: recvBuf(RECV_BUF_NUM_PACKETS * (maxSize + NET_HEADER_SIZE)), recvBufUsed(0), maxPacketSize(maxSize)
 {
-	recvBuf[0] = 0;
 }
 
 void
 AsioReceiveBuffer::StartAsyncRead(boost::shared_ptr<SessionData> session)
 {
 	session->GetAsioSocket()->async_read_some(
-		boost::asio::buffer(recvBuf + recvBufUsed, RECV_BUF_SIZE - recvBufUsed),
+		boost::asio::buffer(&recvBuf[recvBufUsed], recvBuf.size() - recvBufUsed),
 		boost::bind(
 			&ReceiveBuffer::HandleRead,
 			shared_from_this(),
@@ -103,7 +103,7 @@ AsioReceiveBuffer::ScanPackets(boost::shared_ptr<SessionData> session)
 			uint32_t nativeVal;
 			memcpy(&nativeVal, &recvBuf[0], sizeof(uint32_t));
 			size_t packetSize = ntohl(nativeVal);
-			if (packetSize > MAX_PACKET_SIZE) {
+			if (packetSize > maxPacketSize) {
 				recvBufUsed = 0;
 				LOG_ERROR("Session " << session->GetId() << " - Invalid packet size: " << packetSize);
 			} else if (recvBufUsed >= packetSize + NET_HEADER_SIZE) {
@@ -112,7 +112,7 @@ AsioReceiveBuffer::ScanPackets(boost::shared_ptr<SessionData> session)
 					if (tmpPacket) {
 						recvBufUsed -= (packetSize + NET_HEADER_SIZE);
 						if (recvBufUsed) {
-							memmove(recvBuf, recvBuf + packetSize + NET_HEADER_SIZE, recvBufUsed);
+							memmove(&recvBuf[0], &recvBuf[packetSize + NET_HEADER_SIZE], recvBufUsed);
 						}
 					}
 				} catch (const exception &e) {
@@ -123,26 +123,51 @@ AsioReceiveBuffer::ScanPackets(boost::shared_ptr<SessionData> session)
 			}
 		}
 		if (tmpPacket) {
-			if (validator.IsValidPacket(*tmpPacket)) {
-				receivedPackets.push_back(tmpPacket);
-			} else {
-				LOG_ERROR("Session " << session->GetId() << " - Invalid packet: " << tmpPacket->GetMsg()->messagetype());
-			}
+			AddReceivedPacket(session, tmpPacket);
 		} else {
 			dataAvailable = false;
 		}
 	} while(dataAvailable);
 }
 
+void
+AsioReceiveBuffer::AddReceivedPacket(boost::shared_ptr<SessionData> session, boost::shared_ptr<NetPacket> packet)
+{
+	if (!validator.IsValidPacket(*packet)) {
+		LOG_ERROR("Session " << session->GetId() << " - Invalid packet: " << packet->GetMsg()->messagetype());
+	} else if (packet->GetMsg()->messagetype() == PokerTHMessage::Type_CompressedPacketsMessage) {
+		// Only the client receive buffer is sized for compressed packets.
+		// Peers with a small receive limit (i.e. the server) never receive
+		// them, and accepting them would bypass the packet size limit.
+		if (maxPacketSize < MAX_COMPRESSED_PACKET_SIZE) {
+			LOG_ERROR("Session " << session->GetId() << " - Unexpected compressed packet.");
+			return;
+		}
+		NetPacketList tmpList;
+		// The largest packets sent by the server are avatar data chunks.
+		if (NetPacket::Decompress(*packet, tmpList, MAX_AVATAR_PACKET_SIZE)) {
+			BOOST_FOREACH(boost::shared_ptr<NetPacket> tmpPacket, tmpList) {
+				AddReceivedPacket(session, tmpPacket);
+			}
+		} else {
+			LOG_ERROR("Session " << session->GetId() << " - Invalid compressed packet.");
+		}
+	} else {
+		receivedPackets.push_back(packet);
+	}
+}
+
 void
 AsioReceiveBuffer::ProcessPackets(boost::shared_ptr<SessionData> session)
 {
-	while (!receivedPackets.empty()) {
-		boost::shared_ptr<NetPacket> p = receivedPackets.front();
-		receivedPackets.pop_front();
-		session->HandlePacket(p);
+	if (!receivedPackets.empty()) {
+		// Handle all packets of this read at once, so that replies are
+		// collected and written with a single send operation.
+		NetPacketList tmpPackets;
+		tmpPackets.swap(receivedPackets);
+		session->HandlePacketBatch(tmpPackets);
 	}
-	if (recvBufUsed >= RECV_BUF_SIZE) {
+	if (recvBufUsed >= recvBuf.size()) {
 		LOG_ERROR("Session " << session->GetId() << " - Receive buf full: " << recvBufUsed);
 		recvBufUsed = 0;
 	}
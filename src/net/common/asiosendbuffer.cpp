@@ -42,7 +42,8 @@ using namespace std;
 
 AsioSendBuffer::AsioSendBuffer()
 	: sendBuf(NULL), curWriteBuf(NULL), sendBufAllocated(0), sendBufUsed(0),
-	  curWriteBufAllocated(0), curWriteBufUsed(0), closeAfterSend(false)
+	  curWriteBufAllocated(0), curWriteBufUsed(0), sendBufNumPackets(0), closeAfterSend(false),
+	  overflow(false)
 {
 }
 
@@ -65,6 +66,10 @@ AsioSendBuffer::HandleWrite(boost::shared_ptr<boost::asio::ip::tcp::socket> sock
 		// Successfully sent the data.
 		boost::mutex::scoped_lock lock(dataMutex);
 		curWriteBufUsed = 0;
+		// The client is reading again, add the coalesced lobby updates.
+		if (!droppablePackets.empty() && sendBufUsed < SEND_QUEUE_SOFT_LIMIT) {
+			StoreDroppablePackets();
+		}
 		// Send more data, if available.
 		AsyncSendNextPacket(socket);
 	}
@@ -84,6 +89,7 @@ AsioSendBuffer::AsyncSendNextPacket(boost::shared_ptr<boost::asio::ip::tcp::sock
 		boost::swap(curWriteBuf, sendBuf);
 		boost::swap(curWriteBufAllocated, sendBufAllocated);
 		boost::swap(curWriteBufUsed, sendBufUsed);
+		sendBufNumPackets = 0;
 		if (curWriteBufUsed) {
 			boost::asio::async_write(
 				*socket,
@@ -98,15 +104,79 @@ AsioSendBuffer::AsyncSendNextPacket(boost::shared_ptr<boost::asio::ip::tcp::sock
 	}
 }
 
-void
-AsioSendBuffer::InternalStorePacket(boost::shared_ptr<SessionData> /*session*/, boost::shared_ptr<NetPacket> packet)
+SendBuffer::StoreResult
+AsioSendBuffer::InternalStorePacket(boost::shared_ptr<SessionData> session, boost::shared_ptr<NetPacket> packet)
+{
+	return InternalStore(session, packet, NULL);
+}
+
+SendBuffer::StoreResult
+AsioSendBuffer::InternalStoreEncodedPacket(boost::shared_ptr<SessionData> session, boost::shared_ptr<NetPacket> packet, const std::string &encodedData)
+{
+	return InternalStore(session, packet, &encodedData);
+}
+
+SendBuffer::StoreResult
+AsioSendBuffer::InternalStore(boost::shared_ptr<SessionData> session, boost::shared_ptr<NetPacket> packet, const std::string *encodedData)
+{
+	if (overflow) {
+		return STORE_DISCARDED;
+	}
+	if (packet->IsDroppable() && IsCongested(session)) {
+		// Keep only the latest update of this kind until the client catches up.
+		droppablePackets[make_pair(packet->GetMsg()->messagetype(), packet->GetDroppableKey())] = packet;
+		return STORE_DROPPED;
+	}
+	int encodeResult = -1;
+	if (sendBufNumPackets < SEND_QUEUE_MAX_PACKETS) {
+		if (encodedData) {
+			encodeResult = EncodeToBuf(encodedData->data(), encodedData->size());
+			if (encodeResult == 0)
+				++sendBufNumPackets;
+		} else {
+			encodeResult = EncodePacket(*packet);
+		}
+	}
+	if (encodeResult != 0) {
+		// The client does not read its data. Stop buffering.
+		overflow = true;
+		droppablePackets.clear();
+		return STORE_OVERFLOW;
+	}
+	return STORE_OK;
+}
+
+bool
+AsioSendBuffer::IsCongested(boost::shared_ptr<SessionData> /*session*/) const
+{
+	return sendBufUsed + curWriteBufUsed >= SEND_QUEUE_SOFT_LIMIT;
+}
+
+int
+AsioSendBuffer::EncodePacket(const NetPacket &packet)
 {
-	uint32_t packetSize = packet->GetMsg()->ByteSize();
+	uint32_t packetSize = packet.GetMsg()->ByteSize();
 	google::protobuf::uint8 *buf = new google::protobuf::uint8[packetSize + NET_HEADER_SIZE];
 	*((uint32_t *)buf) = htonl(packetSize);
-	packet->GetMsg()->SerializeWithCachedSizesToArray(&buf[NET_HEADER_SIZE]);
-	EncodeToBuf(buf, packetSize + NET_HEADER_SIZE);
+	packet.GetMsg()->SerializeWithCachedSizesToArray(&buf[NET_HEADER_SIZE]);
+	int retVal = EncodeToBuf(buf, packetSize + NET_HEADER_SIZE);
 	delete[] buf;
+	if (retVal == 0) {
+		++sendBufNumPackets;
+	}
+	return retVal;
+}
+
+void
+AsioSendBuffer::StoreDroppablePackets()
+{
+	DroppablePacketMap::const_iterator i = droppablePackets.begin();
+	DroppablePacketMap::const_iterator end = droppablePackets.end();
+	while (i != end) {
+		EncodePacket(*i->second);
+		++i;
+	}
+	droppablePackets.clear();
 }
 
 int
@@ -704,39 +704,17 @@ AbstractClientStateReceiving::HandlePacket(boost::shared_ptr<ClientThread> clien
 		}
 	} else if (tmpPacket->GetMsg()->messagetype() == PokerTHMessage::Type_GameListNewMessage) {
 		// A new game was created on the server.
-		const GameListNewMessage &netListNew = tmpPacket->GetMsg()->gamelistnewmessage();
-
-		// Request player info for players if needed.
-		GameInfo tmpInfo;
-		list<unsigned> requestList;
-		// All players.
-		for (int i = 0; i < netListNew.playerids_size(); i++) {
-			PlayerInfo info;
-			unsigned playerId = netListNew.playerids(i);
-			if (!client->GetCachedPlayerInfo(playerId, info)) {
-				requestList.push_back(playerId);
-			}
-			tmpInfo.players.push_back(playerId);
+		HandleGameListNew(client, tmpPacket->GetMsg()->gamelistnewmessage());
+	} else if (tmpPacket->GetMsg()->messagetype() == PokerTHMessage::Type_LobbySnapshotMessage) {
+		// Lobby state after login, replaces the single player list and game list messages.
+		const LobbySnapshotMessage &netSnapshot = tmpPacket->GetMsg()->lobbysnapshotmessage();
+		for (int i = 0; i < netSnapshot.playerids_size(); i++) {
+			unsigned playerId = netSnapshot.playerids(i);
+			client->GetCallback().SignalLobbyPlayerJoined(playerId, client->GetPlayerName(playerId));
 		}
-		// All spectators.
-		for (int i = 0; i < netListNew.spectatorids_size(); i++) {
-			PlayerInfo info;
-			unsigned playerId = netListNew.spectatorids(i);
-			if (!client->GetCachedPlayerInfo(playerId, info)) {
-				requestList.push_back(playerId);
-			}
-			tmpInfo.spectators.push_back(playerId);
+		for (int i = 0; i < netSnapshot.games_size(); i++) {
+			HandleGameListNew(client, netSnapshot.games(i));
 		}
-		// Send request for multiple players (will only act if list is non-empty).
-		client->RequestPlayerInfo(requestList);
-
-		tmpInfo.adminPlayerId = netListNew.adminplayerid();
-		tmpInfo.isPasswordProtected = netListNew.isprivate();
-		tmpInfo.mode = static_cast<GameMode>(netListNew.gamemode());
-		tmpInfo.name = netListNew.gameinfo().gamename();
-		NetPacket::GetGameData(netListNew.gameinfo(), tmpInfo.data);
-
-		client->AddGameInfo(netListNew.gameid(), tmpInfo);
 	} else if (tmpPacket->GetMsg()->messagetype() == PokerTHMessage::Type_GameListUpdateMessage) {
 		// An existing game was updated on the server.
 		const GameListUpdateMessage &netListUpdate = tmpPacket->GetMsg()->gamelistupdatemessage();
@@ -885,6 +863,42 @@ AbstractClientStateReceiving::HandlePacket(boost::shared_ptr<ClientThread> clien
 	InternalHandlePacket(client, tmpPacket);
 }
 
+void
+AbstractClientStateReceiving::HandleGameListNew(boost::shared_ptr<ClientThread> client, const GameListNewMessage &netListNew)
+{
+	// Request player info for players if needed.
+	GameInfo tmpInfo;
+	list<unsigned> requestList;
+	// All players.
+	for (int i = 0; i < netListNew.playerids_size(); i++) {
+		PlayerInfo info;
+		unsigned playerId = netListNew.playerids(i);
+		if (!client->GetCachedPlayerInfo(playerId, info)) {
+			requestList.push_back(playerId);
+		}
+		tmpInfo.players.push_back(playerId);
+	}
+	// All spectators.
+	for (int i = 0; i < netListNew.spectatorids_size(); i++) {
+		PlayerInfo info;
+		unsigned playerId = netListNew.spectatorids(i);
+		if (!client->GetCachedPlayerInfo(playerId, info)) {
+			requestList.push_back(playerId);
+		}
+		tmpInfo.spectators.push_back(playerId);
+	}
+	// Send request for multiple players (will only act if list is non-empty).
+	client->RequestPlayerInfo(requestList);
+
+	tmpInfo.adminPlayerId = netListNew.adminplayerid();
+	tmpInfo.isPasswordProtected = netListNew.isprivate();
+	tmpInfo.mode = static_cast<GameMode>(netListNew.gamemode());
+	tmpInfo.name = netListNew.gameinfo().gamename();
+	NetPacket::GetGameData(netListNew.gameinfo(), tmpInfo.data);
+
+	client->AddGameInfo(netListNew.gameid(), tmpInfo);
+}
+
 //-----------------------------------------------------------------------------
 
 ClientStateStartSession &
@@ -943,6 +957,7 @@ ClientStateStartSession::InternalHandlePacket(boost::shared_ptr<ClientThread> cl
 			netInit->mutable_requestedversion()->set_majorversion(NET_VERSION_MAJOR);
 			netInit->mutable_requestedversion()->set_minorversion(NET_VERSION_MINOR);
 			netInit->set_buildid(0);
+			netInit->set_supportscompression(true);
 			if (!context.GetSessionGuid().empty()) {
 				netInit->set_mylastsessionid(context.GetSessionGuid());
 			}
@@ -1022,6 +1037,7 @@ ClientStateWaitEnterLogin::TimerLoop(const boost::system::error_code& ec, boost:
 			netInit->mutable_requestedversion()->set_majorversion(NET_VERSION_MAJOR);
 			netInit->mutable_requestedversion()->set_minorversion(NET_VERSION_MINOR);
 			netInit->set_buildid(0);
+			netInit->set_supportscompression(true);
 			if (!context.GetSessionGuid().empty()) {
 				netInit->set_mylastsessionid(context.GetSessionGuid());
 			}
@@ -419,6 +419,15 @@ ClientThread::HandlePacket(boost::shared_ptr<SessionData> /*session*/, boost::sh
 	GetState().HandlePacket(shared_from_this(), packet);
 }
 
+void
+ClientThread::HandlePacketBatch(boost::shared_ptr<SessionData> session, const NetPacketList &packetList)
+{
+	SenderBatch batch(GetSender());
+	BOOST_FOREACH(boost::shared_ptr<NetPacket> packet, packetList) {
+		HandlePacket(session, packet);
+	}
+}
+
 void
 ClientThread::SelectServer(unsigned serverId)
 {
@@ -996,7 +1005,7 @@ ClientThread::CreateContextSession()
 										newSock,
 										SESSION_ID_GENERIC,
 										*this,
-										*m_ioService)));
+										MAX_COMPRESSED_PACKET_SIZE)));
 		GetContext().SetResolver(boost::shared_ptr<boost::asio::ip::tcp::resolver>(
 									 new boost::asio::ip::tcp::resolver(*m_ioService)));
 		validSocket = true;
@@ -0,0 +1,186 @@
+/*****************************************************************************
+ * PokerTH - The open source texas holdem engine                             *
+ * Copyright (C) 2006-2013 Felix Hammer, Florian Thauer, Lothar May          *
+ *                                                                           *
+ * This program is free software: you can redistribute it and/or modify      *
+ * it under the terms of the GNU Affero General Public License as            *
+ * published by the Free Software Foundation, either version 3 of the        *
+ * License, or (at your option) any later version.                           *
+ *                                                                           *
+ * This program is distributed in the hope that it will be useful,           *
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of            *
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the             *
+ * GNU Affero General Public License for more details.                       *
+ *                                                                           *
+ * You should have received a copy of the GNU Affero General Public License  *
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.     *
+ *                                                                           *
+ *                                                                           *
+ * Additional permission under GNU AGPL version 3 section 7                  *
+ *                                                                           *
+ * If you modify this program, or any covered work, by linking or            *
+ * combining it with the OpenSSL project's OpenSSL library (or a             *
+ * modified version of that library), containing parts covered by the        *
+ * terms of the OpenSSL or SSLeay licenses, the authors of PokerTH           *
+ * (Felix Hammer, Florian Thauer, Lothar May) grant you additional           *
+ * permission to convey the resulting work.                                  *
+ * Corresponding Source for a non-source form of such a combination          *
+ * shall include the source code for the parts of OpenSSL used as well       *
+ * as that of the covered work.                                              *
+ *****************************************************************************/
+
+#include <net/gametimerwheel.h>
+
+#include <boost/bind.hpp>
+
+using namespace std;
+
+
+GameTimerWheel::GameTimerWheel(boost::shared_ptr<boost::asio::io_service> ioService)
+	: m_ioService(ioService), m_tickTimer(*ioService), m_tickTimerRunning(false),
+	  m_wheel(GAME_TIMER_NUM_SLOTS), m_curSlot(0), m_curTimerId(0)
+{
+}
+
+GameTimerWheel::~GameTimerWheel()
+{
+}
+
+void
+GameTimerWheel::Stop()
+{
+	m_tickTimer.cancel();
+
+	// The handlers may keep games alive, release them.
+	boost::mutex::scoped_lock lock(m_wheelMutex);
+	m_timerPos.clear();
+	for (unsigned i = 0; i < GAME_TIMER_NUM_SLOTS; i++) {
+		m_wheel[i].clear();
+	}
+}
+
+unsigned
+GameTimerWheel::Schedule(const boost::posix_time::time_duration &delay, const Handler &handler)
+{
+	boost::mutex::scoped_lock lock(m_wheelMutex);
+	m_curTimerId++;
+	if (m_curTimerId == 0) // 0 is an invalid id.
+		m_curTimerId++;
+
+	// A timer expires after at least one tick. If the wheel is running, the
+	// next tick is due at the expiry time of the tick timer, otherwise it is
+	// started below and the next tick is due after one tick interval.
+	long long remainingUsec = delay.total_microseconds();
+	unsigned ticks = 1;
+	if (m_tickTimerRunning) {
+		remainingUsec -= (m_tickTimer.expires_at() - boost::asio::deadline_timer::traits_type::now()).total_microseconds();
+		if (remainingUsec > 0)
+			ticks += static_cast<unsigned>((remainingUsec + GAME_TIMER_TICK_MSEC * 1000 - 1) / (GAME_TIMER_TICK_MSEC * 1000));
+	} else if (remainingUsec > 0) {
+		ticks = static_cast<unsigned>((remainingUsec + GAME_TIMER_TICK_MSEC * 1000 - 1) / (GAME_TIMER_TICK_MSEC * 1000));
+	}
+	unsigned slot = (m_curSlot + ticks) % GAME_TIMER_NUM_SLOTS;
+
+	WheelEntry entry;
+	entry.timerId = m_curTimerId;
+	entry.rounds = (ticks - 1) / GAME_TIMER_NUM_SLOTS;
+	entry.handler = handler;
+
+	TimerPos timerPos;
+	timerPos.slot = slot;
+	timerPos.pos = m_wheel[slot].insert(m_wheel[slot].end(), entry);
+	m_timerPos[m_curTimerId] = timerPos;
+
+	if (!m_tickTimerRunning) {
+		m_tickTimerRunning = true;
+		m_tickTimer.expires_from_now(
+			boost::posix_time::milliseconds(GAME_TIMER_TICK_MSEC));
+		m_tickTimer.async_wait(
+			boost::bind(
+				&GameTimerWheel::TimerTick, shared_from_this(), boost::asio::placeholders::error));
+	}
+	return m_curTimerId;
+}
+
+void
+GameTimerWheel::Cancel(unsigned timerId)
+{
+	boost::mutex::scoped_lock lock(m_wheelMutex);
+	TimerPosMap::iterator pos = m_timerPos.find(timerId);
+	if (pos != m_timerPos.end()) {
+		m_wheel[pos->second.slot].erase(pos->second.pos);
+		m_timerPos.erase(pos);
+	}
+}
+
+void
+GameTimerWheel::TimerTick(const boost::system::error_code &ec)
+{
+	if (!ec) {
+		HandlerList expiredList;
+		{
+			boost::mutex::scoped_lock lock(m_wheelMutex);
+			m_curSlot = (m_curSlot + 1) % GAME_TIMER_NUM_SLOTS;
+			WheelSlot &curSlot = m_wheel[m_curSlot];
+
+			WheelSlot::iterator i = curSlot.begin();
+			WheelSlot::iterator end = curSlot.end();
+			while (i != end) {
+				if (i->rounds > 0) {
+					--i->rounds;
+					++i;
+				} else {
+					expiredList.push_back(i->handler);
+					m_timerPos.erase(i->timerId);
+					i = curSlot.erase(i);
+				}
+			}
+
+			// Keep ticking at a fixed rate while timers are scheduled.
+			if (m_timerPos.empty()) {
+				m_tickTimerRunning = false;
+			} else {
+				m_tickTimer.expires_at(m_tickTimer.expires_at() + boost::posix_time::milliseconds(GAME_TIMER_TICK_MSEC));
+				m_tickTimer.async_wait(
+					boost::bind(
+						&GameTimerWheel::TimerTick, shared_from_this(), boost::asio::placeholders::error));
+			}
+		}
+		// Call the handlers without holding the lock, they usually start new timers.
+		HandlerList::iterator i = expiredList.begin();
+		HandlerList::iterator end = expiredList.end();
+		while (i != end) {
+			(*i)(boost::system::error_code());
+			++i;
+		}
+	} else {
+		boost::mutex::scoped_lock lock(m_wheelMutex);
+		m_tickTimerRunning = false;
+	}
+}
+
+GameTimer::GameTimer(boost::shared_ptr<GameTimerWheel> wheel)
+	: m_wheel(wheel), m_timerId(0)
+{
+}
+
+GameTimer::~GameTimer()
+{
+	Cancel();
+}
+
+void
+GameTimer::Start(const boost::posix_time::time_duration &delay, const GameTimerWheel::Handler &handler)
+{
+	Cancel();
+	m_timerId = m_wheel->Schedule(delay, handler);
+}
+
+void
+GameTimer::Cancel()
+{
+	if (m_timerId) {
+		m_wheel->Cancel(m_timerId);
+		m_timerId = 0;
+	}
+}
@@ -32,13 +32,71 @@
 #include <net/netpacket.h>
 #include <net/socket_msg.h>
 
+#include <boost/asio.hpp>
 #include <boost/foreach.hpp>
+#include <boost/thread.hpp>
+#include <boost/iostreams/filtering_stream.hpp>
+#include <boost/iostreams/filter/zlib.hpp>
+#include <boost/iostreams/device/array.hpp>
+#include <boost/iostreams/device/back_inserter.hpp>
+#include <vector>
 
 using namespace std;
 
+class NetMessagePool
+{
+public:
+	NetMessagePool() {
+		m_freeList.reserve(NET_MSG_POOL_MAX_SIZE);
+	}
+
+	~NetMessagePool() {
+		BOOST_FOREACH(PokerTHMessage *msg, m_freeList) {
+			delete msg;
+		}
+	}
+
+	PokerTHMessage *Alloc() {
+		{
+			boost::mutex::scoped_lock lock(m_poolMutex);
+			if (!m_freeList.empty()) {
+				PokerTHMessage *msg = m_freeList.back();
+				m_freeList.pop_back();
+				return msg;
+			}
+		}
+		return PokerTHMessage::default_instance().New();
+	}
+
+	void Release(PokerTHMessage *msg) {
+		// Clearing a message keeps the capacity of its strings and repeated
+		// fields, so large messages (e.g. avatar data) are deleted instead.
+		if (msg->ByteSize() > NET_MSG_POOL_MAX_MSG_SIZE) {
+			delete msg;
+			return;
+		}
+		// Clear outside of the lock.
+		msg->Clear();
+		{
+			boost::mutex::scoped_lock lock(m_poolMutex);
+			if (m_freeList.size() < NET_MSG_POOL_MAX_SIZE) {
+				m_freeList.push_back(msg);
+				msg = NULL;
+			}
+		}
+		delete msg;
+	}
+
+private:
+	std::vector<PokerTHMessage *> m_freeList;
+	boost::mutex m_poolMutex;
+};
+
+static NetMessagePool g_msgPool;
+
 NetPacket::NetPacket()
 {
-	m_msg = PokerTHMessage::default_instance().New();
+	m_msg = AllocMsg();
 }
 
 NetPacket::NetPacket(PokerTHMessage *msg)
@@ -48,7 +106,7 @@ NetPacket::NetPacket(PokerTHMessage *msg)
 
 NetPacket::~NetPacket()
 {
-	delete m_msg;
+	ReleaseMsg(m_msg);
 }
 
 boost::shared_ptr<NetPacket>
@@ -58,16 +116,138 @@ NetPacket::Create(const char *data, size_t dataSize)
 
 	// Check minimum requirements.
 	if (data && dataSize > 0) {
-		PokerTHMessage *msg = PokerTHMessage::default_instance().New();
+		PokerTHMessage *msg = AllocMsg();
 		if (msg->ParseFromArray(data, static_cast<int>(dataSize))) {
 			tmpPacket.reset(new NetPacket(msg));
 		} else {
-			delete msg;
+			ReleaseMsg(msg);
 		}
 	}
 	return tmpPacket;
 }
 
+static size_t
+CompressPacketGroup(const NetPacketList &groupList, const string &rawData, NetPacketList &outList)
+{
+	string compressedData;
+	if (rawData.size() >= NET_COMPRESS_MIN_DATA_SIZE) {
+		boost::iostreams::filtering_ostream out;
+		out.push(boost::iostreams::zlib_compressor());
+		out.push(boost::iostreams::back_inserter(compressedData));
+		out.write(rawData.data(), rawData.size());
+		out.reset();
+	}
+	if (!compressedData.empty() && compressedData.size() < rawData.size()) {
+		boost::shared_ptr<NetPacket> packet(new NetPacket);
+		packet->GetMsg()->set_messagetype(PokerTHMessage::Type_CompressedPacketsMessage);
+		CompressedPacketsMessage *netCompressed = packet->GetMsg()->mutable_compressedpacketsmessage();
+		netCompressed->set_uncompressedsize(static_cast<unsigned>(rawData.size()));
+		netCompressed->mutable_compresseddata()->swap(compressedData);
+		size_t packetSize = packet->GetMsg()->ByteSize() + NET_HEADER_SIZE;
+		if (packetSize < rawData.size()) {
+			outList.push_back(packet);
+			return rawData.size() - packetSize;
+		}
+	}
+	outList.insert(outList.end(), groupList.begin(), groupList.end());
+	return 0;
+}
+
+size_t
+NetPacket::Compress(const NetPacketList &inList, NetPacketList &outList)
+{
+	size_t bytesSaved = 0;
+	NetPacketList groupList;
+	string rawData;
+	rawData.reserve(MAX_UNCOMPRESSED_DATA_SIZE);
+
+	NetPacketList::const_iterator i = inList.begin();
+	NetPacketList::const_iterator end = inList.end();
+	while (i != end) {
+		if (!*i) {
+			++i;
+			continue;
+		}
+		size_t packetSize = (*i)->GetMsg()->ByteSize() + NET_HEADER_SIZE;
+		if (!groupList.empty() && rawData.size() + packetSize > MAX_UNCOMPRESSED_DATA_SIZE) {
+			bytesSaved += CompressPacketGroup(groupList, rawData, outList);
+			groupList.clear();
+			rawData.clear();
+		}
+		if (packetSize > MAX_UNCOMPRESSED_DATA_SIZE) {
+			outList.push_back(*i);
+		} else {
+			(*i)->AppendEncodedData(rawData);
+			groupList.push_back(*i);
+		}
+		++i;
+	}
+	if (!groupList.empty()) {
+		bytesSaved += CompressPacketGroup(groupList, rawData, outList);
+	}
+	return bytesSaved;
+}
+
+bool
+NetPacket::Decompress(const NetPacket &packet, NetPacketList &outList, size_t maxPacketSize)
+{
+	const CompressedPacketsMessage &netCompressed = packet.GetMsg()->compressedpacketsmessage();
+	size_t rawSize = netCompressed.uncompressedsize();
+	if (rawSize == 0 || rawSize > MAX_UNCOMPRESSED_DATA_SIZE) {
+		return false;
+	}
+	// Read one byte more than announced to detect wrong sizes.
+	vector<char> rawData(rawSize + 1);
+	try {
+		boost::iostreams::filtering_istream in;
+		in.push(boost::iostreams::zlib_decompressor());
+		in.push(boost::iostreams::array_source(netCompressed.compresseddata().data(), netCompressed.compresseddata().size()));
+		in.read(&rawData[0], rawData.size());
+		if (static_cast<size_t>(in.gcount()) != rawSize) {
+			return false;
+		}
+	} catch (const exception &) {
+		return false;
+	}
+
+	NetPacketList tmpList;
+	size_t pos = 0;
+	while (pos + NET_HEADER_SIZE <= rawSize) {
+		uint32_t nativeVal;
+		memcpy(&nativeVal, &rawData[pos], sizeof(uint32_t));
+		size_t packetSize = ntohl(nativeVal);
+		if (packetSize > maxPacketSize || pos + NET_HEADER_SIZE + packetSize > rawSize) {
+			return false;
+		}
+		boost::shared_ptr<NetPacket> tmpPacket = Create(&rawData[pos + NET_HEADER_SIZE], packetSize);
+		// Compressed packets may not be nested.
+		if (!tmpPacket || tmpPacket->GetMsg()->messagetype() == PokerTHMessage::Type_CompressedPacketsMessage) {
+			return false;
+		}
+		tmpList.push_back(tmpPacket);
+		pos += NET_HEADER_SIZE + packetSize;
+	}
+	if (pos != rawSize) {
+		return false;
+	}
+	outList.splice(outList.end(), tmpList);
+	return true;
+}
+
+PokerTHMessage *
+NetPacket::AllocMsg()
+{
+	return g_msgPool.Alloc();
+}
+
+void
+NetPacket::ReleaseMsg(PokerTHMessage *msg)
+{
+	if (msg) {
+		g_msgPool.Release(msg);
+	}
+}
+
 bool
 NetPacket::IsClientActivity() const
 {
@@ -88,6 +268,40 @@ NetPacket::IsClientActivity() const
 	return retVal;
 }
 
+bool
+NetPacket::IsDroppable() const
+{
+	bool retVal = false;
+	if (m_msg &&
+			(m_msg->messagetype() == PokerTHMessage::Type_GameListUpdateMessage
+			 || m_msg->messagetype() == PokerTHMessage::Type_StatisticsMessage)) {
+		retVal = true;
+	}
+	return retVal;
+}
+
+unsigned
+NetPacket::GetDroppableKey() const
+{
+	// Newer updates replace older updates with the same key.
+	unsigned retVal = 0;
+	if (m_msg && m_msg->messagetype() == PokerTHMessage::Type_GameListUpdateMessage) {
+		retVal = m_msg->gamelistupdatemessage().gameid();
+	}
+	return retVal;
+}
+
+void
+NetPacket::AppendEncodedData(string &data) const
+{
+	uint32_t packetSize = m_msg->ByteSize();
+	uint32_t netSize = htonl(packetSize);
+	size_t pos = data.size();
+	data.resize(pos + NET_HEADER_SIZE + packetSize);
+	memcpy(&data[pos], &netSize, NET_HEADER_SIZE);
+	m_msg->SerializeWithCachedSizesToArray((google::protobuf::uint8 *)&data[pos + NET_HEADER_SIZE]);
+}
+
 string
 NetPacket::ToString() const
 {
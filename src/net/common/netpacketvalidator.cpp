@@ -54,88 +54,91 @@ ValidateListIntRange(const ::google::protobuf::RepeatedField< ::google::protobuf
 }
 
 NetPacketValidator::NetPacketValidator()
-{
-	m_validationMap.insert(make_pair(PokerTHMessage_PokerTHMessageType_Type_AnnounceMessage, ValidateAnnounceMessage));
-	m_validationMap.insert(make_pair(PokerTHMessage_PokerTHMessageType_Type_InitMessage, ValidateInitMessage));
-	m_validationMap.insert(make_pair(PokerTHMessage_PokerTHMessageType_Type_AuthServerChallengeMessage, ValidateAuthServerChallengeMessage));
-	m_validationMap.insert(make_pair(PokerTHMessage_PokerTHMessageType_Type_AuthClientResponseMessage, ValidateAuthClientResponseMessage));
-	m_validationMap.insert(make_pair(PokerTHMessage_PokerTHMessageType_Type_AuthServerVerificationMessage, ValidateAuthServerVerificationMessage));
-	m_validationMap.insert(make_pair(PokerTHMessage_PokerTHMessageType_Type_InitAckMessage, ValidateInitAckMessage));
-	m_validationMap.insert(make_pair(PokerTHMessage_PokerTHMessageType_Type_AvatarRequestMessage, ValidateAvatarRequestMessage));
-	m_validationMap.insert(make_pair(PokerTHMessage_PokerTHMessageType_Type_AvatarHeaderMessage, ValidateAvatarHeaderMessage));
-	m_validationMap.insert(make_pair(PokerTHMessage_PokerTHMessageType_Type_AvatarDataMessage, ValidateAvatarDataMessage));
-	m_validationMap.insert(make_pair(PokerTHMessage_PokerTHMessageType_Type_AvatarEndMessage, ValidateAvatarEndMessage));
-	m_validationMap.insert(make_pair(PokerTHMessage_PokerTHMessageType_Type_UnknownAvatarMessage, ValidateUnknownAvatarMessage));
-	m_validationMap.insert(make_pair(PokerTHMessage_PokerTHMessageType_Type_PlayerListMessage, ValidatePlayerListMessage));
-	m_validationMap.insert(make_pair(PokerTHMessage_PokerTHMessageType_Type_GameListNewMessage, ValidateGameListNewMessage));
-	m_validationMap.insert(make_pair(PokerTHMessage_PokerTHMessageType_Type_GameListUpdateMessage, ValidateGameListUpdateMessage));
-	m_validationMap.insert(make_pair(PokerTHMessage_PokerTHMessageType_Type_GameListPlayerJoinedMessage, ValidateGameListPlayerJoinedMessage));
-	m_validationMap.insert(make_pair(PokerTHMessage_PokerTHMessageType_Type_GameListPlayerLeftMessage, ValidateGameListPlayerLeftMessage));
-	m_validationMap.insert(make_pair(PokerTHMessage_PokerTHMessageType_Type_GameListAdminChangedMessage, ValidateGameListAdminChangedMessage));
-	m_validationMap.insert(make_pair(PokerTHMessage_PokerTHMessageType_Type_PlayerInfoRequestMessage, ValidatePlayerInfoRequestMessage));
-	m_validationMap.insert(make_pair(PokerTHMessage_PokerTHMessageType_Type_PlayerInfoReplyMessage, ValidatePlayerInfoReplyMessage));
-	m_validationMap.insert(make_pair(PokerTHMessage_PokerTHMessageType_Type_SubscriptionRequestMessage, ValidateSubscriptionRequestMessage));
-	m_validationMap.insert(make_pair(PokerTHMessage_PokerTHMessageType_Type_JoinExistingGameMessage, ValidateJoinExistingGameMessage));
-	m_validationMap.insert(make_pair(PokerTHMessage_PokerTHMessageType_Type_JoinNewGameMessage, ValidateJoinNewGameMessage));
-	m_validationMap.insert(make_pair(PokerTHMessage_PokerTHMessageType_Type_RejoinExistingGameMessage, ValidateRejoinExistingGameMessage));
-	m_validationMap.insert(make_pair(PokerTHMessage_PokerTHMessageType_Type_JoinGameAckMessage, ValidateJoinGameAckMessage));
-	m_validationMap.insert(make_pair(PokerTHMessage_PokerTHMessageType_Type_JoinGameFailedMessage, ValidateJoinGameFailedMessage));
-	m_validationMap.insert(make_pair(PokerTHMessage_PokerTHMessageType_Type_GamePlayerJoinedMessage, ValidateGamePlayerJoinedMessage));
-	m_validationMap.insert(make_pair(PokerTHMessage_PokerTHMessageType_Type_GamePlayerLeftMessage, ValidateGamePlayerLeftMessage));
-	m_validationMap.insert(make_pair(PokerTHMessage_PokerTHMessageType_Type_GameAdminChangedMessage, ValidateGameAdminChangedMessage));
-	m_validationMap.insert(make_pair(PokerTHMessage_PokerTHMessageType_Type_RemovedFromGameMessage, ValidateRemovedFromGameMessage));
-	m_validationMap.insert(make_pair(PokerTHMessage_PokerTHMessageType_Type_KickPlayerRequestMessage, ValidateKickPlayerRequestMessage));
-	m_validationMap.insert(make_pair(PokerTHMessage_PokerTHMessageType_Type_LeaveGameRequestMessage, ValidateLeaveGameRequestMessage));
-	m_validationMap.insert(make_pair(PokerTHMessage_PokerTHMessageType_Type_InvitePlayerToGameMessage, ValidateInvitePlayerToGameMessage));
-	m_validationMap.insert(make_pair(PokerTHMessage_PokerTHMessageType_Type_InviteNotifyMessage, ValidateInviteNotifyMessage));
-	m_validationMap.insert(make_pair(PokerTHMessage_PokerTHMessageType_Type_RejectGameInvitationMessage, ValidateRejectGameInvitationMessage));
-	m_validationMap.insert(make_pair(PokerTHMessage_PokerTHMessageType_Type_RejectInvNotifyMessage, ValidateRejectInvNotifyMessage));
-	m_validationMap.insert(make_pair(PokerTHMessage_PokerTHMessageType_Type_StartEventMessage, ValidateStartEventMessage));
-	m_validationMap.insert(make_pair(PokerTHMessage_PokerTHMessageType_Type_StartEventAckMessage, ValidateStartEventAckMessage));
-	m_validationMap.insert(make_pair(PokerTHMessage_PokerTHMessageType_Type_GameStartInitialMessage, ValidateGameStartInitialMessage));
-	m_validationMap.insert(make_pair(PokerTHMessage_PokerTHMessageType_Type_GameStartRejoinMessage, ValidateGameStartRejoinMessage));
-	m_validationMap.insert(make_pair(PokerTHMessage_PokerTHMessageType_Type_HandStartMessage, ValidateHandStartMessage));
-	m_validationMap.insert(make_pair(PokerTHMessage_PokerTHMessageType_Type_PlayersTurnMessage, ValidatePlayersTurnMessage));
-	m_validationMap.insert(make_pair(PokerTHMessage_PokerTHMessageType_Type_MyActionRequestMessage, ValidateMyActionRequestMessage));
-	m_validationMap.insert(make_pair(PokerTHMessage_PokerTHMessageType_Type_YourActionRejectedMessage, ValidateYourActionRejectedMessage));
-	m_validationMap.insert(make_pair(PokerTHMessage_PokerTHMessageType_Type_PlayersActionDoneMessage, ValidatePlayersActionDoneMessage));
-	m_validationMap.insert(make_pair(PokerTHMessage_PokerTHMessageType_Type_DealFlopCardsMessage, ValidateDealFlopCardsMessage));
-	m_validationMap.insert(make_pair(PokerTHMessage_PokerTHMessageType_Type_DealTurnCardMessage, ValidateDealTurnCardMessage));
-	m_validationMap.insert(make_pair(PokerTHMessage_PokerTHMessageType_Type_DealRiverCardMessage, ValidateDealRiverCardMessage));
-	m_validationMap.insert(make_pair(PokerTHMessage_PokerTHMessageType_Type_AllInShowCardsMessage, ValidateAllInShowCardsMessage));
-	m_validationMap.insert(make_pair(PokerTHMessage_PokerTHMessageType_Type_EndOfHandShowCardsMessage, ValidateEndOfHandShowCardsMessage));
-	m_validationMap.insert(make_pair(PokerTHMessage_PokerTHMessageType_Type_EndOfHandHideCardsMessage, ValidateEndOfHandHideCardsMessage));
-	m_validationMap.insert(make_pair(PokerTHMessage_PokerTHMessageType_Type_ShowMyCardsRequestMessage, ValidateShowMyCardsRequestMessage));
-	m_validationMap.insert(make_pair(PokerTHMessage_PokerTHMessageType_Type_AfterHandShowCardsMessage, ValidateAfterHandShowCardsMessage));
-	m_validationMap.insert(make_pair(PokerTHMessage_PokerTHMessageType_Type_EndOfGameMessage, ValidateEndOfGameMessage));
-	m_validationMap.insert(make_pair(PokerTHMessage_PokerTHMessageType_Type_PlayerIdChangedMessage, ValidatePlayerIdChangedMessage));
-	m_validationMap.insert(make_pair(PokerTHMessage_PokerTHMessageType_Type_AskKickPlayerMessage, ValidateAskKickPlayerMessage));
-	m_validationMap.insert(make_pair(PokerTHMessage_PokerTHMessageType_Type_AskKickDeniedMessage, ValidateAskKickDeniedMessage));
-	m_validationMap.insert(make_pair(PokerTHMessage_PokerTHMessageType_Type_StartKickPetitionMessage, ValidateStartKickPetitionMessage));
-	m_validationMap.insert(make_pair(PokerTHMessage_PokerTHMessageType_Type_VoteKickRequestMessage, ValidateVoteKickRequestMessage));
-	m_validationMap.insert(make_pair(PokerTHMessage_PokerTHMessageType_Type_VoteKickReplyMessage, ValidateVoteKickReplyMessage));
-	m_validationMap.insert(make_pair(PokerTHMessage_PokerTHMessageType_Type_KickPetitionUpdateMessage, ValidateKickPetitionUpdateMessage));
-	m_validationMap.insert(make_pair(PokerTHMessage_PokerTHMessageType_Type_EndKickPetitionMessage, ValidateEndKickPetitionMessage));
-	m_validationMap.insert(make_pair(PokerTHMessage_PokerTHMessageType_Type_StatisticsMessage, ValidateStatisticsMessage));
-	m_validationMap.insert(make_pair(PokerTHMessage_PokerTHMessageType_Type_ChatRequestMessage, ValidateChatRequestMessage));
-	m_validationMap.insert(make_pair(PokerTHMessage_PokerTHMessageType_Type_ChatMessage, ValidateChatMessage));
-	m_validationMap.insert(make_pair(PokerTHMessage_PokerTHMessageType_Type_ChatRejectMessage, ValidateChatRejectMessage));
-	m_validationMap.insert(make_pair(PokerTHMessage_PokerTHMessageType_Type_DialogMessage, ValidateDialogMessage));
-	m_validationMap.insert(make_pair(PokerTHMessage_PokerTHMessageType_Type_TimeoutWarningMessage, ValidateTimeoutWarningMessage));
-	m_validationMap.insert(make_pair(PokerTHMessage_PokerTHMessageType_Type_ResetTimeoutMessage, ValidateResetTimeoutMessage));
-	m_validationMap.insert(make_pair(PokerTHMessage_PokerTHMessageType_Type_ReportAvatarMessage, ValidateReportAvatarMessage));
-	m_validationMap.insert(make_pair(PokerTHMessage_PokerTHMessageType_Type_ReportAvatarAckMessage, ValidateReportAvatarAckMessage));
-	m_validationMap.insert(make_pair(PokerTHMessage_PokerTHMessageType_Type_ReportGameMessage, ValidateReportGameMessage));
-	m_validationMap.insert(make_pair(PokerTHMessage_PokerTHMessageType_Type_ReportGameAckMessage, ValidateReportGameAckMessage));
-	m_validationMap.insert(make_pair(PokerTHMessage_PokerTHMessageType_Type_ErrorMessage, ValidateErrorMessage));
-	m_validationMap.insert(make_pair(PokerTHMessage_PokerTHMessageType_Type_AdminRemoveGameMessage, ValidateAdminRemoveGameMessage));
-	m_validationMap.insert(make_pair(PokerTHMessage_PokerTHMessageType_Type_AdminRemoveGameAckMessage, ValidateAdminRemoveGameAckMessage));
-	m_validationMap.insert(make_pair(PokerTHMessage_PokerTHMessageType_Type_AdminBanPlayerMessage, ValidateAdminBanPlayerMessage));
-	m_validationMap.insert(make_pair(PokerTHMessage_PokerTHMessageType_Type_AdminBanPlayerAckMessage, ValidateAdminBanPlayerAckMessage));
-	m_validationMap.insert(make_pair(PokerTHMessage_PokerTHMessageType_Type_GameListSpectatorJoinedMessage, ValidateGameListSpectatorJoinedMessage));
-	m_validationMap.insert(make_pair(PokerTHMessage_PokerTHMessageType_Type_GameListSpectatorLeftMessage, ValidateGameListSpectatorLeftMessage));
-	m_validationMap.insert(make_pair(PokerTHMessage_PokerTHMessageType_Type_GameSpectatorJoinedMessage, ValidateGameSpectatorJoinedMessage));
-	m_validationMap.insert(make_pair(PokerTHMessage_PokerTHMessageType_Type_GameSpectatorLeftMessage, ValidateGameSpectatorLeftMessage));
+	: m_validationTable(PokerTHMessage::PokerTHMessageType_ARRAYSIZE, (ValidateFunctor)NULL)
+{
+	m_validationTable[PokerTHMessage_PokerTHMessageType_Type_AnnounceMessage] = ValidateAnnounceMessage;
+	m_validationTable[PokerTHMessage_PokerTHMessageType_Type_InitMessage] = ValidateInitMessage;
+	m_validationTable[PokerTHMessage_PokerTHMessageType_Type_AuthServerChallengeMessage] = ValidateAuthServerChallengeMessage;
+	m_validationTable[PokerTHMessage_PokerTHMessageType_Type_AuthClientResponseMessage] = ValidateAuthClientResponseMessage;
+	m_validationTable[PokerTHMessage_PokerTHMessageType_Type_AuthServerVerificationMessage] = ValidateAuthServerVerificationMessage;
+	m_validationTable[PokerTHMessage_PokerTHMessageType_Type_InitAckMessage] = ValidateInitAckMessage;
+	m_validationTable[PokerTHMessage_PokerTHMessageType_Type_AvatarRequestMessage] = ValidateAvatarRequestMessage;
+	m_validationTable[PokerTHMessage_PokerTHMessageType_Type_AvatarHeaderMessage] = ValidateAvatarHeaderMessage;
+	m_validationTable[PokerTHMessage_PokerTHMessageType_Type_AvatarDataMessage] = ValidateAvatarDataMessage;
+	m_validationTable[PokerTHMessage_PokerTHMessageType_Type_AvatarEndMessage] = ValidateAvatarEndMessage;
+	m_validationTable[PokerTHMessage_PokerTHMessageType_Type_UnknownAvatarMessage] = ValidateUnknownAvatarMessage;
+	m_validationTable[PokerTHMessage_PokerTHMessageType_Type_PlayerListMessage] = ValidatePlayerListMessage;
+	m_validationTable[PokerTHMessage_PokerTHMessageType_Type_GameListNewMessage] = ValidateGameListNewMessage;
+	m_validationTable[PokerTHMessage_PokerTHMessageType_Type_GameListUpdateMessage] = ValidateGameListUpdateMessage;
+	m_validationTable[PokerTHMessage_PokerTHMessageType_Type_GameListPlayerJoinedMessage] = ValidateGameListPlayerJoinedMessage;
+	m_validationTable[PokerTHMessage_PokerTHMessageType_Type_GameListPlayerLeftMessage] = ValidateGameListPlayerLeftMessage;
+	m_validationTable[PokerTHMessage_PokerTHMessageType_Type_GameListAdminChangedMessage] = ValidateGameListAdminChangedMessage;
+	m_validationTable[PokerTHMessage_PokerTHMessageType_Type_PlayerInfoRequestMessage] = ValidatePlayerInfoRequestMessage;
+	m_validationTable[PokerTHMessage_PokerTHMessageType_Type_PlayerInfoReplyMessage] = ValidatePlayerInfoReplyMessage;
+	m_validationTable[PokerTHMessage_PokerTHMessageType_Type_SubscriptionRequestMessage] = ValidateSubscriptionRequestMessage;
+	m_validationTable[PokerTHMessage_PokerTHMessageType_Type_JoinExistingGameMessage] = ValidateJoinExistingGameMessage;
+	m_validationTable[PokerTHMessage_PokerTHMessageType_Type_JoinNewGameMessage] = ValidateJoinNewGameMessage;
+	m_validationTable[PokerTHMessage_PokerTHMessageType_Type_RejoinExistingGameMessage] = ValidateRejoinExistingGameMessage;
+	m_validationTable[PokerTHMessage_PokerTHMessageType_Type_JoinGameAckMessage] = ValidateJoinGameAckMessage;
+	m_validationTable[PokerTHMessage_PokerTHMessageType_Type_JoinGameFailedMessage] = ValidateJoinGameFailedMessage;
+	m_validationTable[PokerTHMessage_PokerTHMessageType_Type_GamePlayerJoinedMessage] = ValidateGamePlayerJoinedMessage;
+	m_validationTable[PokerTHMessage_PokerTHMessageType_Type_GamePlayerLeftMessage] = ValidateGamePlayerLeftMessage;
+	m_validationTable[PokerTHMessage_PokerTHMessageType_Type_GameAdminChangedMessage] = ValidateGameAdminChangedMessage;
+	m_validationTable[PokerTHMessage_PokerTHMessageType_Type_RemovedFromGameMessage] = ValidateRemovedFromGameMessage;
+	m_validationTable[PokerTHMessage_PokerTHMessageType_Type_KickPlayerRequestMessage] = ValidateKickPlayerRequestMessage;
+	m_validationTable[PokerTHMessage_PokerTHMessageType_Type_LeaveGameRequestMessage] = ValidateLeaveGameRequestMessage;
+	m_validationTable[PokerTHMessage_PokerTHMessageType_Type_InvitePlayerToGameMessage] = ValidateInvitePlayerToGameMessage;
+	m_validationTable[PokerTHMessage_PokerTHMessageType_Type_InviteNotifyMessage] = ValidateInviteNotifyMessage;
+	m_validationTable[PokerTHMessage_PokerTHMessageType_Type_RejectGameInvitationMessage] = ValidateRejectGameInvitationMessage;
+	m_validationTable[PokerTHMessage_PokerTHMessageType_Type_RejectInvNotifyMessage] = ValidateRejectInvNotifyMessage;
+	m_validationTable[PokerTHMessage_PokerTHMessageType_Type_StartEventMessage] = ValidateStartEventMessage;
+	m_validationTable[PokerTHMessage_PokerTHMessageType_Type_StartEventAckMessage] = ValidateStartEventAckMessage;
+	m_validationTable[PokerTHMessage_PokerTHMessageType_Type_GameStartInitialMessage] = ValidateGameStartInitialMessage;
+	m_validationTable[PokerTHMessage_PokerTHMessageType_Type_GameStartRejoinMessage] = ValidateGameStartRejoinMessage;
+	m_validationTable[PokerTHMessage_PokerTHMessageType_Type_HandStartMessage] = ValidateHandStartMessage;
+	m_validationTable[PokerTHMessage_PokerTHMessageType_Type_PlayersTurnMessage] = ValidatePlayersTurnMessage;
+	m_validationTable[PokerTHMessage_PokerTHMessageType_Type_MyActionRequestMessage] = ValidateMyActionRequestMessage;
+	m_validationTable[PokerTHMessage_PokerTHMessageType_Type_YourActionRejectedMessage] = ValidateYourActionRejectedMessage;
+	m_validationTable[PokerTHMessage_PokerTHMessageType_Type_PlayersActionDoneMessage] = ValidatePlayersActionDoneMessage;
+	m_validationTable[PokerTHMessage_PokerTHMessageType_Type_DealFlopCardsMessage] = ValidateDealFlopCardsMessage;
+	m_validationTable[PokerTHMessage_PokerTHMessageType_Type_DealTurnCardMessage] = ValidateDealTurnCardMessage;
+	m_validationTable[PokerTHMessage_PokerTHMessageType_Type_DealRiverCardMessage] = ValidateDealRiverCardMessage;
+	m_validationTable[PokerTHMessage_PokerTHMessageType_Type_AllInShowCardsMessage] = ValidateAllInShowCardsMessage;
+	m_validationTable[PokerTHMessage_PokerTHMessageType_Type_EndOfHandShowCardsMessage] = ValidateEndOfHandShowCardsMessage;
+	m_validationTable[PokerTHMessage_PokerTHMessageType_Type_EndOfHandHideCardsMessage] = ValidateEndOfHandHideCardsMessage;
+	m_validationTable[PokerTHMessage_PokerTHMessageType_Type_ShowMyCardsRequestMessage] = ValidateShowMyCardsRequestMessage;
+	m_validationTable[PokerTHMessage_PokerTHMessageType_Type_AfterHandShowCardsMessage] = ValidateAfterHandShowCardsMessage;
+	m_validationTable[PokerTHMessage_PokerTHMessageType_Type_EndOfGameMessage] = ValidateEndOfGameMessage;
+	m_validationTable[PokerTHMessage_PokerTHMessageType_Type_PlayerIdChangedMessage] = ValidatePlayerIdChangedMessage;
+	m_validationTable[PokerTHMessage_PokerTHMessageType_Type_AskKickPlayerMessage] = ValidateAskKickPlayerMessage;
+	m_validationTable[PokerTHMessage_PokerTHMessageType_Type_AskKickDeniedMessage] = ValidateAskKickDeniedMessage;
+	m_validationTable[PokerTHMessage_PokerTHMessageType_Type_StartKickPetitionMessage] = ValidateStartKickPetitionMessage;
+	m_validationTable[PokerTHMessage_PokerTHMessageType_Type_VoteKickRequestMessage] = ValidateVoteKickRequestMessage;
+	m_validationTable[PokerTHMessage_PokerTHMessageType_Type_VoteKickReplyMessage] = ValidateVoteKickReplyMessage;
+	m_validationTable[PokerTHMessage_PokerTHMessageType_Type_KickPetitionUpdateMessage] = ValidateKickPetitionUpdateMessage;
+	m_validationTable[PokerTHMessage_PokerTHMessageType_Type_EndKickPetitionMessage] = ValidateEndKickPetitionMessage;
+	m_validationTable[PokerTHMessage_PokerTHMessageType_Type_StatisticsMessage] = ValidateStatisticsMessage;
+	m_validationTable[PokerTHMessage_PokerTHMessageType_Type_ChatRequestMessage] = ValidateChatRequestMessage;
+	m_validationTable[PokerTHMessage_PokerTHMessageType_Type_ChatMessage] = ValidateChatMessage;
+	m_validationTable[PokerTHMessage_PokerTHMessageType_Type_ChatRejectMessage] = ValidateChatRejectMessage;
+	m_validationTable[PokerTHMessage_PokerTHMessageType_Type_DialogMessage] = ValidateDialogMessage;
+	m_validationTable[PokerTHMessage_PokerTHMessageType_Type_TimeoutWarningMessage] = ValidateTimeoutWarningMessage;
+	m_validationTable[PokerTHMessage_PokerTHMessageType_Type_ResetTimeoutMessage] = ValidateResetTimeoutMessage;
+	m_validationTable[PokerTHMessage_PokerTHMessageType_Type_ReportAvatarMessage] = ValidateReportAvatarMessage;
+	m_validationTable[PokerTHMessage_PokerTHMessageType_Type_ReportAvatarAckMessage] = ValidateReportAvatarAckMessage;
+	m_validationTable[PokerTHMessage_PokerTHMessageType_Type_ReportGameMessage] = ValidateReportGameMessage;
+	m_validationTable[PokerTHMessage_PokerTHMessageType_Type_ReportGameAckMessage] = ValidateReportGameAckMessage;
+	m_validationTable[PokerTHMessage_PokerTHMessageType_Type_ErrorMessage] = ValidateErrorMessage;
+	m_validationTable[PokerTHMessage_PokerTHMessageType_Type_AdminRemoveGameMessage] = ValidateAdminRemoveGameMessage;
+	m_validationTable[PokerTHMessage_PokerTHMessageType_Type_AdminRemoveGameAckMessage] = ValidateAdminRemoveGameAckMessage;
+	m_validationTable[PokerTHMessage_PokerTHMessageType_Type_AdminBanPlayerMessage] = ValidateAdminBanPlayerMessage;
+	m_validationTable[PokerTHMessage_PokerTHMessageType_Type_AdminBanPlayerAckMessage] = ValidateAdminBanPlayerAckMessage;
+	m_validationTable[PokerTHMessage_PokerTHMessageType_Type_GameListSpectatorJoinedMessage] = ValidateGameListSpectatorJoinedMessage;
+	m_validationTable[PokerTHMessage_PokerTHMessageType_Type_GameListSpectatorLeftMessage] = ValidateGameListSpectatorLeftMessage;
+	m_validationTable[PokerTHMessage_PokerTHMessageType_Type_GameSpectatorJoinedMessage] = ValidateGameSpectatorJoinedMessage;
+	m_validationTable[PokerTHMessage_PokerTHMessageType_Type_GameSpectatorLeftMessage] = ValidateGameSpectatorLeftMessage;
+	m_validationTable[PokerTHMessage_PokerTHMessageType_Type_LobbySnapshotMessage] = ValidateLobbySnapshotMessage;
+	m_validationTable[PokerTHMessage_PokerTHMessageType_Type_CompressedPacketsMessage] = ValidateCompressedPacketsMessage;
 }
 
 bool
@@ -143,10 +146,10 @@ NetPacketValidator::IsValidPacket(const NetPacket &packet) const
 {
 	// Default: Invalid packet.
 	bool retVal = false;
-	ValidateFunctorMap::const_iterator pos = m_validationMap.find(packet.GetMsg()->messagetype());
-	if (pos != m_validationMap.end()) {
+	unsigned type = static_cast<unsigned>(packet.GetMsg()->messagetype());
+	if (type < m_validationTable.size() && m_validationTable[type]) {
 		// Call validation functor.
-		retVal = pos->second(packet);
+		retVal = m_validationTable[type](packet);
 	}
 	return retVal;
 }
@@ -283,7 +286,7 @@ NetPacketValidator::ValidateAvatarDataMessage(const NetPacket &packet)
 	if (packet.GetMsg()->has_avatardatamessage()) {
 		const AvatarDataMessage &msg = packet.GetMsg()->avatardatamessage();
 		if (msg.requestid() != 0
-				&& VALIDATE_STRING_SIZE(msg.avatarblock(), 1, 256)) {
+				&& VALIDATE_STRING_SIZE(msg.avatarblock(), 1, MAX_AVATAR_CHUNK_SIZE)) {
 
 			retVal = true;
 		}
@@ -335,14 +338,7 @@ NetPacketValidator::ValidateGameListNewMessage(const NetPacket &packet)
 {
 	bool retVal = false;
 	if (packet.GetMsg()->has_gamelistnewmessage()) {
-		const GameListNewMessage &msg = packet.GetMsg()->gamelistnewmessage();
-		if (msg.gameid() != 0
-				&& VALIDATE_LIST_SIZE(msg.playerids(), 0, 10)
-				&& msg.adminplayerid() != 0
-				&& ValidateGameInfo(msg.gameinfo())) {
-
-			retVal = true;
-		}
+		retVal = ValidateGameListNew(packet.GetMsg()->gamelistnewmessage());
 	}
 	return retVal;
 }
@@ -1279,3 +1275,51 @@ NetPacketValidator::ValidateGameSpectatorLeftMessage(const NetPacket &packet)
 	return retVal;
 }
 
+
+bool
+NetPacketValidator::ValidateLobbySnapshotMessage(const NetPacket &packet)
+{
+	bool retVal = false;
+	if (packet.GetMsg()->has_lobbysnapshotmessage()) {
+		const LobbySnapshotMessage &msg = packet.GetMsg()->lobbysnapshotmessage();
+		retVal = true;
+		for (int i = 0; i < msg.playerids_size(); i++) {
+			if (msg.playerids(i) == 0) {
+				retVal = false;
+				break;
+			}
+		}
+		for (int i = 0; retVal && i < msg.games_size(); i++) {
+			retVal = ValidateGameListNew(msg.games(i));
+		}
+	}
+	return retVal;
+}
+
+bool
+NetPacketValidator::ValidateCompressedPacketsMessage(const NetPacket &packet)
+{
+	bool retVal = false;
+	if (packet.GetMsg()->has_compressedpacketsmessage()) {
+		const CompressedPacketsMessage &msg = packet.GetMsg()->compressedpacketsmessage();
+		if (VALIDATE_UINT_RANGE(msg.uncompressedsize(), 1, MAX_UNCOMPRESSED_DATA_SIZE)
+				&& VALIDATE_STRING_SIZE(msg.compresseddata(), 1, MAX_UNCOMPRESSED_DATA_SIZE)) {
+			retVal = true;
+		}
+	}
+	return retVal;
+}
+
+bool
+NetPacketValidator::ValidateGameListNew(const GameListNewMessage &gameListNew)
+{
+	bool retVal = false;
+	if (gameListNew.gameid() != 0
+			&& VALIDATE_LIST_SIZE(gameListNew.playerids(), 0, 10)
+			&& gameListNew.adminplayerid() != 0
+			&& ValidateGameInfo(gameListNew.gameinfo())) {
+
+		retVal = true;
+	}
+	return retVal;
+}
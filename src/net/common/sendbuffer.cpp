@@ -38,3 +38,10 @@ SendBuffer::~SendBuffer()
 {
 }
 
+SendBuffer::StoreResult
+SendBuffer::InternalStoreEncodedPacket(boost::shared_ptr<SessionData> session, boost::shared_ptr<NetPacket> packet, const std::string &/*encodedData*/)
+{
+	// By default, the encoded data is not used.
+	return InternalStorePacket(session, packet);
+}
+
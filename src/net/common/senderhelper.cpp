@@ -35,13 +35,14 @@
 #include <net/socket_helper.h>
 #include <net/socket_msg.h>
 #include <core/loghelper.h>
+#include <boost/bind.hpp>
 #include <cstring>
 #include <cassert>
 
 using namespace std;
 
 SenderHelper::SenderHelper(boost::shared_ptr<boost::asio::io_service> ioService)
-	: m_ioService(ioService)
+	: m_ioService(ioService), m_batchDepth(0)
 {
 }
 
@@ -56,9 +57,10 @@ SenderHelper::Send(boost::shared_ptr<SessionData> session, boost::shared_ptr<Net
 		SendBuffer &tmpBuffer = session->GetSendBuffer();
 		// Add packet to specific queue.
 		boost::mutex::scoped_lock lock(tmpBuffer.dataMutex);
-		tmpBuffer.InternalStorePacket(session, packet);
+		InternalHandleStoreResult(session, tmpBuffer.InternalStorePacket(session, packet));
 		// Activate async send, if needed.
-		tmpBuffer.AsyncSendNextPacket(session);
+		if (!DeferAsyncSend(session))
+			tmpBuffer.AsyncSendNextPacket(session);
 	}
 }
 
@@ -66,21 +68,101 @@ void
 SenderHelper::Send(boost::shared_ptr<SessionData> session, const NetPacketList &packetList)
 {
 	if (!packetList.empty() && session) {
-		SendBuffer &tmpBuffer = session->GetSendBuffer();
-		// Add packets to specific queue.
-		boost::mutex::scoped_lock lock(tmpBuffer.dataMutex);
-		NetPacketList::const_iterator i = packetList.begin();
-		NetPacketList::const_iterator end = packetList.end();
+		if (packetList.size() > 1 && session->IsCompressionEnabled()) {
+			NetPacketList compressedList;
+			size_t bytesSaved = NetPacket::Compress(packetList, compressedList);
+			InternalSend(session, packetList, &compressedList, bytesSaved);
+		} else {
+			InternalSend(session, packetList, NULL, 0);
+		}
+	}
+}
+
+void
+SenderHelper::Send(const SessionList &sessionList, const NetPacketList &packetList)
+{
+	if (!packetList.empty()) {
+		NetPacketList compressedList;
+		bool isCompressed = false;
+		size_t bytesSaved = 0;
+		// Encode the packets once, instead of once for each session.
+		EncodedPacketList encodedList;
+		EncodedPacketList encodedCompressedList;
+		bool shareEncoding = sessionList.size() > 1;
+		if (shareEncoding)
+			EncodePackets(packetList, encodedList);
+		SessionList::const_iterator i = sessionList.begin();
+		SessionList::const_iterator end = sessionList.end();
 		while (i != end) {
-			if (*i)
-				tmpBuffer.InternalStorePacket(session, *i);
+			if (packetList.size() > 1 && (*i)->IsCompressionEnabled()) {
+				if (!isCompressed) {
+					bytesSaved = NetPacket::Compress(packetList, compressedList);
+					if (shareEncoding)
+						EncodePackets(compressedList, encodedCompressedList);
+					isCompressed = true;
+				}
+				InternalSend(*i, packetList, &compressedList, bytesSaved,
+							 shareEncoding ? &encodedList : NULL, shareEncoding ? &encodedCompressedList : NULL);
+			} else {
+				InternalSend(*i, packetList, NULL, 0, shareEncoding ? &encodedList : NULL);
+			}
 			++i;
 		}
-		// Activate async send, if needed.
-		tmpBuffer.AsyncSendNextPacket(session);
 	}
 }
 
+void
+SenderHelper::EncodePackets(const NetPacketList &packetList, EncodedPacketList &encodedList)
+{
+	encodedList.resize(packetList.size());
+	EncodedPacketList::iterator encoded_i = encodedList.begin();
+	NetPacketList::const_iterator i = packetList.begin();
+	NetPacketList::const_iterator end = packetList.end();
+	while (i != end) {
+		if (*i)
+			(*i)->AppendEncodedData(*encoded_i);
+		++encoded_i;
+		++i;
+	}
+}
+
+void
+SenderHelper::InternalSend(boost::shared_ptr<SessionData> session, const NetPacketList &packetList, const NetPacketList *compressedList, size_t bytesSaved,
+						   const EncodedPacketList *encodedList, const EncodedPacketList *encodedCompressedList)
+{
+	SendBuffer &tmpBuffer = session->GetSendBuffer();
+	// Add packets to specific queue.
+	boost::mutex::scoped_lock lock(tmpBuffer.dataMutex);
+	// Congested sessions receive the plain packets, because droppable
+	// packets cannot be coalesced within a compressed packet.
+	const NetPacketList *tmpList = &packetList;
+	const EncodedPacketList *tmpEncodedList = encodedList;
+	if (compressedList && !tmpBuffer.IsCongested(session)) {
+		tmpList = compressedList;
+		tmpEncodedList = encodedCompressedList;
+		if (bytesSaved) {
+			boost::mutex::scoped_lock statLock(m_statMutex);
+			m_stats.numCompressionSavedBytes += bytesSaved;
+		}
+	}
+	size_t index = 0;
+	NetPacketList::const_iterator i = tmpList->begin();
+	NetPacketList::const_iterator end = tmpList->end();
+	while (i != end) {
+		if (*i) {
+			if (tmpEncodedList)
+				InternalHandleStoreResult(session, tmpBuffer.InternalStoreEncodedPacket(session, *i, (*tmpEncodedList)[index]));
+			else
+				InternalHandleStoreResult(session, tmpBuffer.InternalStorePacket(session, *i));
+		}
+		++index;
+		++i;
+	}
+	// Activate async send, if needed.
+	if (!DeferAsyncSend(session))
+		tmpBuffer.AsyncSendNextPacket(session);
+}
+
 void
 SenderHelper::SetCloseAfterSend(boost::shared_ptr<SessionData> session)
 {
@@ -90,6 +172,71 @@ SenderHelper::SetCloseAfterSend(boost::shared_ptr<SessionData> session)
 	// Mark that the socket should be closed after the send operation.
 	tmpBuffer.SetCloseAfterSend();
 	// Activate async send, if needed.
-	tmpBuffer.AsyncSendNextPacket(session);
+	if (!DeferAsyncSend(session))
+		tmpBuffer.AsyncSendNextPacket(session);
+}
+
+SendStats
+SenderHelper::GetStats() const
+{
+	boost::mutex::scoped_lock lock(m_statMutex);
+	return m_stats;
+}
+
+void
+SenderHelper::StartBatch()
+{
+	boost::mutex::scoped_lock lock(m_batchMutex);
+	++m_batchDepth;
+}
+
+void
+SenderHelper::EndBatch()
+{
+	SessionSet tmpSessions;
+	{
+		boost::mutex::scoped_lock lock(m_batchMutex);
+		assert(m_batchDepth > 0);
+		if (--m_batchDepth == 0) {
+			m_batchSessions.swap(tmpSessions);
+		}
+	}
+	// Flush the send buffers outside of the batch lock.
+	SessionSet::iterator i = tmpSessions.begin();
+	SessionSet::iterator end = tmpSessions.end();
+	while (i != end) {
+		SendBuffer &tmpBuffer = (*i)->GetSendBuffer();
+		boost::mutex::scoped_lock lock(tmpBuffer.dataMutex);
+		tmpBuffer.AsyncSendNextPacket(*i);
+		++i;
+	}
 }
 
+bool
+SenderHelper::DeferAsyncSend(boost::shared_ptr<SessionData> session)
+{
+	bool retVal = false;
+	boost::mutex::scoped_lock lock(m_batchMutex);
+	if (m_batchDepth > 0) {
+		m_batchSessions.insert(session);
+		retVal = true;
+	}
+	return retVal;
+}
+
+void
+SenderHelper::InternalHandleStoreResult(boost::shared_ptr<SessionData> session, int result)
+{
+	if (result == SendBuffer::STORE_DROPPED) {
+		boost::mutex::scoped_lock lock(m_statMutex);
+		++m_stats.numDroppedPackets;
+	} else if (result == SendBuffer::STORE_OVERFLOW) {
+		LOG_ERROR("Session " << session->GetId() << " - Send queue limit exceeded, closing session.");
+		{
+			boost::mutex::scoped_lock lock(m_statMutex);
+			++m_stats.numEvictedSessions;
+		}
+		// The send buffer is locked, therefore close the session later.
+		m_ioService->post(boost::bind(&SessionData::Close, session));
+	}
+}
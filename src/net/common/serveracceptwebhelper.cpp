@@ -77,6 +77,12 @@ ServerAcceptWebHelper::validate(websocketpp::connection_hdl hdl)
 {
 	bool retVal = false;
 	server::connection_ptr con = m_webSocketServer->get_con_from_hdl(hdl);
+	// Reject banned or flooding addresses before creating a session.
+	boost::system::error_code ec;
+	boost::asio::ip::tcp::endpoint remoteEndpoint = con->get_raw_socket().remote_endpoint(ec);
+	if (!ec && !m_lobbyThread->IsConnectionAllowed(remoteEndpoint.address())) {
+		return false;
+	}
 	if ((m_webSocketResource.empty() || con->get_resource() == m_webSocketResource)
 			&& (m_webSocketOrigin.empty() ||
 			(con->get_origin() != "null" &&
@@ -92,15 +98,15 @@ ServerAcceptWebHelper::on_open(websocketpp::connection_hdl hdl)
 	boost::shared_ptr<WebSocketData> webData(new WebSocketData);
 	webData->webSocketServer = m_webSocketServer;
 	webData->webHandle = hdl;
-	boost::shared_ptr<SessionData> sessionData(new SessionData(webData, m_lobbyThread->GetNextSessionId(), m_lobbyThread->GetSessionDataCallback(), *m_ioService, 0));
-	m_sessionMap.insert(make_pair(hdl, sessionData));
+	boost::shared_ptr<SessionData> sessionData(new SessionData(webData, m_lobbyThread->GetNextSessionId(), m_lobbyThread->GetSessionDataCallback(), 0));
+	m_sessionMap.insert(make_pair(GetHandleKey(hdl), sessionData));
 	m_lobbyThread->AddConnection(sessionData);
 }
 
 void
 ServerAcceptWebHelper::on_close(websocketpp::connection_hdl hdl)
 {
-	SessionMap::iterator pos = m_sessionMap.find(hdl);
+	SessionMap::iterator pos = m_sessionMap.find(GetHandleKey(hdl));
 	if (pos != m_sessionMap.end()) {
 		boost::shared_ptr<SessionData> tmpSession = pos->second.lock();
 		if (tmpSession) {
@@ -114,13 +120,19 @@ void
 ServerAcceptWebHelper::on_message(websocketpp::connection_hdl hdl, server::message_ptr msg)
 {
 	if (msg->get_opcode() == websocketpp::frame::opcode::BINARY) {
-		SessionMap::iterator pos = m_sessionMap.find(hdl);
+		SessionMap::iterator pos = m_sessionMap.find(GetHandleKey(hdl));
 		if (pos != m_sessionMap.end()) {
 			boost::shared_ptr<SessionData> tmpSession = pos->second.lock();
 			if (tmpSession) {
+				// The packet is parsed directly from the message payload.
 				tmpSession->GetReceiveBuffer().HandleMessage(tmpSession, msg->get_payload());
 			}
 		}
 	}
 }
 
+const void *
+ServerAcceptWebHelper::GetHandleKey(websocketpp::connection_hdl hdl)
+{
+	return hdl.lock().get();
+}
@@ -147,8 +147,10 @@ ServerAdminBot::SignalIrcChatMsg(const std::string &nickName, const std::string
 					if (!ipAddress.empty()) {
 						ostringstream durationStr;
 						durationStr << durationHours;
-						GetLobbyThread().GetBanManager().BanIPAddress(ipAddress, durationHours);
-						m_ircAdminThread->SendChatMessage(nickName + ": The IP address \"" + ipAddress + "\" was added to the IP address ban list for " + durationStr.str() + (durationHours == 1 ? " hour." : " hours."));
+						if (GetLobbyThread().GetBanManager().BanIPAddress(ipAddress, durationHours))
+							m_ircAdminThread->SendChatMessage(nickName + ": The IP address \"" + ipAddress + "\" was added to the IP address ban list for " + durationStr.str() + (durationHours == 1 ? " hour." : " hours."));
+						else
+							m_ircAdminThread->SendChatMessage(nickName + ": Invalid IP address or range \"" + ipAddress + "\".");
 					}
 				} else if (command == "listban") {
 					list<string> banList;
@@ -208,6 +210,19 @@ ServerAdminBot::SignalIrcChatMsg(const std::string &nickName, const std::string
 								<< "    (Max at a time: " << tmpStats.maxGamesOpen << ")";
 						m_ircAdminThread->SendChatMessage(statStream.str());
 					}
+					{
+						ostringstream statStream;
+						statStream
+								<< "Dropped lobby updates........ " << tmpStats.numberOfDroppedPackets
+								<< "    (Slow clients closed: " << tmpStats.numberOfEvictedSessions << ")";
+						m_ircAdminThread->SendChatMessage(statStream.str());
+					}
+					{
+						ostringstream statStream;
+						statStream
+								<< "Saved by compression......... " << tmpStats.compressionSavedKBytes << " KB";
+						m_ircAdminThread->SendChatMessage(statStream.str());
+					}
 				} else if (command == "chat") {
 					while (msgStream.peek() == ' ')
 						msgStream.get();
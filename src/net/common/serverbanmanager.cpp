@@ -30,13 +30,15 @@
  *****************************************************************************/
 
 #include <net/serverbanmanager.h>
+#include <core/loghelper.h>
 #include <algorithm>
+#include <cstdlib>
 
 using namespace std;
 
 
 ServerBanManager::ServerBanManager(boost::shared_ptr<boost::asio::io_service> ioService)
-	: m_ioService(ioService), m_curBanId(0)
+	: m_ioService(ioService), m_hasBanPlayerRegex(false), m_hasGameNameBadWordRegex(false), m_banIPTree(1), m_curBanId(0)
 {
 }
 
@@ -63,6 +65,7 @@ ServerBanManager::BanPlayerName(const std::string &playerName, unsigned duration
 	tmpBan.timer = InternalRegisterTimedBan(banId, durationHours);
 	tmpBan.nameStr = playerName;
 	m_banPlayerNameMap[banId] = tmpBan;
+	m_banPlayerNames.insert(playerName);
 }
 
 void
@@ -75,18 +78,25 @@ ServerBanManager::BanPlayerRegex(const string &playerRegex, unsigned durationHou
 	tmpBan.timer = InternalRegisterTimedBan(banId, durationHours);
 	tmpBan.nameRegex = boost::regex(playerRegex, boost::regex::extended | boost::regex::icase);
 	m_banPlayerNameMap[banId] = tmpBan;
+	InternalRebuildBanIndex();
 }
 
-void
+bool
 ServerBanManager::BanIPAddress(const string &ipAddress, unsigned durationHours)
 {
+	TimedIPBan tmpBan;
+	if (!ParseIPRange(ipAddress, tmpBan.prefix, tmpBan.prefixLength)) {
+		LOG_ERROR("Invalid IP address ban: " << ipAddress);
+		return false;
+	}
 	boost::mutex::scoped_lock lock(m_banMutex);
 	unsigned banId = GetNextBanId();
 
-	TimedIPBan tmpBan;
 	tmpBan.timer = InternalRegisterTimedBan(banId, durationHours);
 	tmpBan.ipAddress = ipAddress;
 	m_banIPAddressMap[banId] = tmpBan;
+	InternalRebuildIPBanIndex();
+	return true;
 }
 
 bool
@@ -99,6 +109,7 @@ ServerBanManager::UnBan(unsigned banId)
 		if (posNick->second.timer)
 			posNick->second.timer->cancel();
 		m_banPlayerNameMap.erase(posNick);
+		InternalRebuildBanIndex();
 		retVal = true;
 	} else {
 		IPAddressMap::iterator posIP = m_banIPAddressMap.find(banId);
@@ -106,6 +117,7 @@ ServerBanManager::UnBan(unsigned banId)
 			if (posIP->second.timer)
 				posIP->second.timer->cancel();
 			m_banIPAddressMap.erase(posIP);
+			InternalRebuildIPBanIndex();
 			retVal = true;
 		}
 	}
@@ -148,6 +160,8 @@ ServerBanManager::ClearBanList()
 	boost::mutex::scoped_lock lock(m_banMutex);
 	m_banPlayerNameMap.clear();
 	m_banIPAddressMap.clear();
+	InternalRebuildBanIndex();
+	InternalRebuildIPBanIndex();
 }
 
 bool
@@ -169,22 +183,10 @@ ServerBanManager::IsPlayerBanned(const std::string &name) const
 {
 	bool retVal = false;
 	boost::mutex::scoped_lock lock(m_banMutex);
-	RegexMap::const_iterator i = m_banPlayerNameMap.begin();
-	RegexMap::const_iterator end = m_banPlayerNameMap.end();
-	while (i != end) {
-		// Use regex only if name not set.
-		if ((*i).second.nameStr.empty()) {
-			if (regex_match(name, (*i).second.nameRegex)) {
-				retVal = true;
-				break;
-			}
-		} else {
-			if (name == (*i).second.nameStr) {
-				retVal = true;
-				break;
-			}
-		}
-		++i;
+	if (m_banPlayerNames.find(name) != m_banPlayerNames.end()) {
+		retVal = true;
+	} else if (m_hasBanPlayerRegex) {
+		retVal = regex_match(name, m_banPlayerRegex);
 	}
 
 	return retVal;
@@ -192,17 +194,30 @@ ServerBanManager::IsPlayerBanned(const std::string &name) const
 
 bool
 ServerBanManager::IsIPAddressBanned(const std::string &ipAddress) const
+{
+	boost::system::error_code ec;
+	boost::asio::ip::address tmpAddress(boost::asio::ip::address::from_string(ipAddress, ec));
+	return !ec && IsIPAddressBanned(tmpAddress);
+}
+
+bool
+ServerBanManager::IsIPAddressBanned(const boost::asio::ip::address &ipAddress) const
 {
 	bool retVal = false;
+	boost::asio::ip::address_v6::bytes_type addrBytes(ToV6Bytes(ipAddress));
 	boost::mutex::scoped_lock lock(m_banMutex);
-	IPAddressMap::const_iterator i = m_banIPAddressMap.begin();
-	IPAddressMap::const_iterator end = m_banIPAddressMap.end();
-	while (i != end) {
-		if (ipAddress == (*i).second.ipAddress) {
+	// Walk down the prefix tree, any banned node on the way matches.
+	unsigned node = 0;
+	for (unsigned bit = 0; bit <= addrBytes.size() * 8; bit++) {
+		if (m_banIPTree[node].banned) {
 			retVal = true;
 			break;
 		}
-		++i;
+		if (bit == addrBytes.size() * 8)
+			break;
+		node = m_banIPTree[node].child[(addrBytes[bit / 8] >> (7 - bit % 8)) & 1];
+		if (!node)
+			break;
 	}
 
 	return retVal;
@@ -211,26 +226,15 @@ ServerBanManager::IsIPAddressBanned(const std::string &ipAddress) const
 void
 ServerBanManager::InitGameNameBadWordList(const std::list<string> &badWordList)
 {
-	list<string>::const_iterator i = badWordList.begin();
-	list<string>::const_iterator end = badWordList.end();
-	while (i != end) {
-		m_gameNameBadWordFilter.push_back(boost::regex(*i, boost::regex::extended | boost::regex::icase));
-		++i;
-	}
+	m_hasGameNameBadWordRegex = CombineRegexList(badWordList, m_gameNameBadWordRegex);
 }
 
 bool
 ServerBanManager::IsBadGameName(const std::string &name) const
 {
 	bool retVal = false;
-	RegexList::const_iterator i = m_gameNameBadWordFilter.begin();
-	RegexList::const_iterator end = m_gameNameBadWordFilter.end();
-	while (i != end) {
-		if (regex_match(name, *i)) {
-			retVal = true;
-			break;
-		}
-		++i;
+	if (m_hasGameNameBadWordRegex) {
+		retVal = regex_match(name, m_gameNameBadWordRegex);
 	}
 	return retVal;
 }
@@ -257,6 +261,104 @@ ServerBanManager::TimerRemoveBan(const boost::system::error_code &ec, unsigned b
 		UnBan(banId);
 }
 
+void
+ServerBanManager::InternalRebuildBanIndex()
+{
+	// This method is not thread safe. Only call after locking the ban mutex.
+	m_banPlayerNames.clear();
+	list<string> regexList;
+	RegexMap::const_iterator i = m_banPlayerNameMap.begin();
+	RegexMap::const_iterator end = m_banPlayerNameMap.end();
+	while (i != end) {
+		// Use regex only if name not set.
+		if ((*i).second.nameStr.empty())
+			regexList.push_back((*i).second.nameRegex.str());
+		else
+			m_banPlayerNames.insert((*i).second.nameStr);
+		++i;
+	}
+	m_hasBanPlayerRegex = CombineRegexList(regexList, m_banPlayerRegex);
+}
+
+void
+ServerBanManager::InternalRebuildIPBanIndex()
+{
+	// This method is not thread safe. Only call after locking the ban mutex.
+	m_banIPTree.assign(1, IPBanNode());
+	IPAddressMap::const_iterator i = m_banIPAddressMap.begin();
+	IPAddressMap::const_iterator end = m_banIPAddressMap.end();
+	while (i != end) {
+		const TimedIPBan &tmpBan = (*i).second;
+		unsigned node = 0;
+		for (unsigned bit = 0; bit < tmpBan.prefixLength; bit++) {
+			unsigned dir = (tmpBan.prefix[bit / 8] >> (7 - bit % 8)) & 1;
+			if (!m_banIPTree[node].child[dir]) {
+				m_banIPTree[node].child[dir] = static_cast<unsigned>(m_banIPTree.size());
+				m_banIPTree.push_back(IPBanNode());
+			}
+			node = m_banIPTree[node].child[dir];
+		}
+		m_banIPTree[node].banned = true;
+		++i;
+	}
+}
+
+bool
+ServerBanManager::ParseIPRange(const std::string &ipRange, boost::asio::ip::address_v6::bytes_type &outPrefix, unsigned &outPrefixLength)
+{
+	string addrStr(ipRange);
+	int prefixLength = -1;
+	string::size_type slashPos = ipRange.find('/');
+	if (slashPos != string::npos) {
+		addrStr = ipRange.substr(0, slashPos);
+		string lengthStr(ipRange.substr(slashPos + 1));
+		if (lengthStr.empty() || lengthStr.find_first_not_of("0123456789") != string::npos || lengthStr.size() > 3)
+			return false;
+		prefixLength = atoi(lengthStr.c_str());
+	}
+	boost::system::error_code ec;
+	boost::asio::ip::address tmpAddress(boost::asio::ip::address::from_string(addrStr, ec));
+	if (ec)
+		return false;
+
+	unsigned maxLength = tmpAddress.is_v4() ? 32 : 128;
+	if (prefixLength < 0)
+		prefixLength = maxLength;
+	else if ((unsigned)prefixLength > maxLength)
+		return false;
+	// IPv4 addresses are mapped to ::ffff:0:0/96.
+	outPrefixLength = prefixLength + (128 - maxLength);
+	outPrefix = ToV6Bytes(tmpAddress);
+	return true;
+}
+
+boost::asio::ip::address_v6::bytes_type
+ServerBanManager::ToV6Bytes(const boost::asio::ip::address &ipAddress)
+{
+	if (ipAddress.is_v4())
+		return boost::asio::ip::address_v6::v4_mapped(ipAddress.to_v4()).to_bytes();
+	return ipAddress.to_v6().to_bytes();
+}
+
+bool
+ServerBanManager::CombineRegexList(const std::list<std::string> &regexList, boost::regex &outRegex)
+{
+	// Extended regular expressions do not have back references,
+	// therefore they can simply be combined as alternatives.
+	string combined;
+	list<string>::const_iterator i = regexList.begin();
+	list<string>::const_iterator end = regexList.end();
+	while (i != end) {
+		if (!combined.empty())
+			combined += '|';
+		combined += "(" + *i + ")";
+		++i;
+	}
+	if (!combined.empty())
+		outRegex = boost::regex(combined, boost::regex::extended | boost::regex::icase);
+	return !combined.empty();
+}
+
 unsigned
 ServerBanManager::GetNextBanId()
 {
@@ -0,0 +1,126 @@
+/*****************************************************************************
+ * PokerTH - The open source texas holdem engine                             *
+ * Copyright (C) 2006-2013 Felix Hammer, Florian Thauer, Lothar May          *
+ *                                                                           *
+ * This program is free software: you can redistribute it and/or modify      *
+ * it under the terms of the GNU Affero General Public License as            *
+ * published by the Free Software Foundation, either version 3 of the        *
+ * License, or (at your option) any later version.                           *
+ *                                                                           *
+ * This program is distributed in the hope that it will be useful,           *
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of            *
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the             *
+ * GNU Affero General Public License for more details.                       *
+ *                                                                           *
+ * You should have received a copy of the GNU Affero General Public License  *
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.     *
+ *                                                                           *
+ *                                                                           *
+ * Additional permission under GNU AGPL version 3 section 7                  *
+ *                                                                           *
+ * If you modify this program, or any covered work, by linking or            *
+ * combining it with the OpenSSL project's OpenSSL library (or a             *
+ * modified version of that library), containing parts covered by the        *
+ * terms of the OpenSSL or SSLeay licenses, the authors of PokerTH           *
+ * (Felix Hammer, Florian Thauer, Lothar May) grant you additional           *
+ * permission to convey the resulting work.                                  *
+ * Corresponding Source for a non-source form of such a combination          *
+ * shall include the source code for the parts of OpenSSL used as well       *
+ * as that of the covered work.                                              *
+ *****************************************************************************/
+
+#include <net/serverconnectlimiter.h>
+
+using namespace std;
+
+#define SERVER_CONNECT_PURGE_INTERVAL_MSEC		1000
+
+
+ServerConnectLimiter::ServerConnectLimiter()
+	: m_lastPurgeMsec(0)
+{
+}
+
+ServerConnectLimiter::~ServerConnectLimiter()
+{
+}
+
+bool
+ServerConnectLimiter::IsConnectAllowed(const boost::asio::ip::address &ipAddress)
+{
+	boost::asio::ip::address_v6 v6Address;
+	if (ipAddress.is_v4())
+		v6Address = boost::asio::ip::address_v6::v4_mapped(ipAddress.to_v4());
+	else
+		v6Address = ipAddress.to_v6();
+	if (v6Address.is_loopback() || (v6Address.is_v4_mapped() && v6Address.to_v4().is_loopback()))
+		return true;
+
+	boost::asio::ip::address_v6::bytes_type addrBytes(v6Address.to_bytes());
+	string addressKey((const char *)addrBytes.data(), addrBytes.size());
+	// IPv4: first 3 bytes of the address, IPv6: first 8 bytes.
+	string subnetKey(addressKey, 0, v6Address.is_v4_mapped() ? 15 : 8);
+
+	boost::mutex::scoped_lock lock(m_bucketMutex);
+	boost::uint64_t nowMsec = m_clock.elapsed().total_milliseconds();
+	if (nowMsec - m_lastPurgeMsec >= SERVER_CONNECT_PURGE_INTERVAL_MSEC
+			&& (m_addressBuckets.size() >= SERVER_CONNECT_MAX_BUCKETS || m_subnetBuckets.size() >= SERVER_CONNECT_MAX_BUCKETS)) {
+		InternalPurgeFullBuckets(m_addressBuckets, SERVER_CONNECT_ADDRESS_RATE_PER_MIN, SERVER_CONNECT_ADDRESS_BURST, nowMsec);
+		InternalPurgeFullBuckets(m_subnetBuckets, SERVER_CONNECT_SUBNET_RATE_PER_MIN, SERVER_CONNECT_SUBNET_BURST, nowMsec);
+		m_lastPurgeMsec = nowMsec;
+	}
+	// Check the subnet first, so that a blocked subnet does not fill the address buckets.
+	return InternalConsumeToken(m_subnetBuckets, subnetKey, SERVER_CONNECT_SUBNET_RATE_PER_MIN, SERVER_CONNECT_SUBNET_BURST, nowMsec)
+		   && InternalConsumeToken(m_addressBuckets, addressKey, SERVER_CONNECT_ADDRESS_RATE_PER_MIN, SERVER_CONNECT_ADDRESS_BURST, nowMsec);
+}
+
+bool
+ServerConnectLimiter::InternalConsumeToken(BucketMap &buckets, const std::string &key, unsigned ratePerMin, unsigned burst, boost::uint64_t nowMsec)
+{
+	bool retVal = false;
+	BucketMap::iterator pos = buckets.find(key);
+	if (pos == buckets.end()) {
+		// Memory is bounded: New sources are not tracked if the table is full.
+		// They are still allowed, so that a single host owning many subnets
+		// cannot lock out everybody else.
+		if (buckets.size() < SERVER_CONNECT_MAX_BUCKETS) {
+			TokenBucket tmpBucket;
+			tmpBucket.milliTokens = (burst - 1) * 1000;
+			tmpBucket.lastUpdateMsec = nowMsec;
+			buckets.insert(BucketMap::value_type(key, tmpBucket));
+		}
+		retVal = true;
+	} else {
+		InternalRefill(pos->second, ratePerMin, burst, nowMsec);
+		if (pos->second.milliTokens >= 1000) {
+			pos->second.milliTokens -= 1000;
+			retVal = true;
+		}
+	}
+	return retVal;
+}
+
+void
+ServerConnectLimiter::InternalRefill(TokenBucket &bucket, unsigned ratePerMin, unsigned burst, boost::uint64_t nowMsec)
+{
+	boost::uint64_t refill = (nowMsec - bucket.lastUpdateMsec) * ratePerMin / 60;
+	if (refill) {
+		bucket.milliTokens = static_cast<unsigned>(min<boost::uint64_t>(bucket.milliTokens + refill, burst * 1000));
+		bucket.lastUpdateMsec = nowMsec;
+	}
+}
+
+void
+ServerConnectLimiter::InternalPurgeFullBuckets(BucketMap &buckets, unsigned ratePerMin, unsigned burst, boost::uint64_t nowMsec)
+{
+	// Full buckets carry no information and can be removed.
+	BucketMap::iterator i = buckets.begin();
+	BucketMap::iterator end = buckets.end();
+	while (i != end) {
+		InternalRefill(i->second, ratePerMin, burst, nowMsec);
+		if (i->second.milliTokens >= burst * 1000)
+			i = buckets.erase(i);
+		else
+			++i;
+	}
+}
@@ -65,8 +65,9 @@ ServerGame::ServerGame(boost::shared_ptr<ServerLobbyThread> lobbyThread, u_int32
 	  m_gameData(gameData), m_curState(NULL), m_id(id), m_name(name),
 	  m_password(pwd), m_creatorPlayerDBId(creatorPlayerDBId), m_playerConfig(playerConfig),
 	  m_gameNum(1), m_curPetitionId(1), m_voteKickTimer(lobbyThread->GetIOService()),
-	  m_stateTimer1(lobbyThread->GetIOService()), m_stateTimer2(lobbyThread->GetIOService()),
-	  m_isNameReported(false)
+	  m_stateTimer1(lobbyThread->GetGameTimers()), m_stateTimer2(lobbyThread->GetGameTimers()),
+	  m_spectatorFeed(lobbyThread->GetSpectatorDelaySec()), m_spectatorFeedTimer(lobbyThread->GetGameTimers()),
+	  m_isNameReported(false), m_rejoinSnapshotHandId(0)
 {
 	LOG_VERBOSE("Game object " << GetId() << " created.");
 }
@@ -86,6 +87,8 @@ void
 ServerGame::Exit()
 {
 	m_voteKickTimer.cancel();
+	m_spectatorFeedTimer.Cancel();
+	m_spectatorFeed.Clear();
 	SetState(ServerGameStateFinal::Instance());
 }
 
@@ -180,13 +183,80 @@ ServerGame::GetCurRound() const
 void
 ServerGame::SendToAllPlayers(boost::shared_ptr<NetPacket> packet, int state)
 {
-	GetSessionManager().SendToAllSessions(GetLobbyThread().GetSender(), packet, state);
+	if ((state & SessionData::Spectating) != 0) {
+		InternalSendToSpectators(packet);
+		state &= ~SessionData::Spectating;
+	}
+	if (state != 0)
+		GetSessionManager().SendToAllSessions(GetLobbyThread().GetSender(), packet, state);
 }
 
 void
 ServerGame::SendToAllButOnePlayers(boost::shared_ptr<NetPacket> packet, SessionId except, int state)
 {
-	GetSessionManager().SendToAllButOneSessions(GetLobbyThread().GetSender(), packet, except, state);
+	// The excluded session is a player, spectators are not excluded.
+	if ((state & SessionData::Spectating) != 0) {
+		InternalSendToSpectators(packet);
+		state &= ~SessionData::Spectating;
+	}
+	if (state != 0)
+		GetSessionManager().SendToAllButOneSessions(GetLobbyThread().GetSender(), packet, except, state);
+}
+
+void
+ServerGame::InvalidateGameListPacket()
+{
+	m_gameListPacket.reset();
+}
+
+void
+ServerGame::AddFeedSpectator(SessionId session, boost::shared_ptr<NetPacket> initialPacket)
+{
+	if (m_spectatorFeed.AddSpectator(session, initialPacket))
+		InternalStartSpectatorFeedTimer();
+}
+
+void
+ServerGame::InternalSendToSpectators(boost::shared_ptr<NetPacket> packet)
+{
+	if (m_spectatorFeed.Push(packet))
+		InternalStartSpectatorFeedTimer();
+}
+
+void
+ServerGame::InternalStartSpectatorFeedTimer()
+{
+	m_spectatorFeedTimer.Start(
+		boost::posix_time::milliseconds(m_spectatorFeed.GetDelayMsec()),
+		boost::bind(
+			&ServerGame::TimerSpectatorFeed, shared_from_this(), boost::asio::placeholders::error));
+}
+
+void
+ServerGame::TimerSpectatorFeed(const boost::system::error_code &ec)
+{
+	if (!ec) {
+		unsigned nextMsec = m_spectatorFeed.Flush(GetSessionManager(), GetLobbyThread().GetSender());
+		if (nextMsec) {
+			m_spectatorFeedTimer.Start(
+				boost::posix_time::milliseconds(nextMsec),
+				boost::bind(
+					&ServerGame::TimerSpectatorFeed, shared_from_this(), boost::asio::placeholders::error));
+		}
+	}
+}
+
+boost::shared_ptr<NetPacket>
+ServerGame::GetHandPacket(PokerTHMessage::PokerTHMessageType type)
+{
+	boost::shared_ptr<NetPacket> &tmpPacket = m_handPackets[type];
+	// Send buffers serialize packets right away. A packet which is still
+	// referenced elsewhere is left alone and replaced by a new one.
+	if (!tmpPacket || !tmpPacket.unique()) {
+		tmpPacket.reset(new NetPacket);
+		tmpPacket->GetMsg()->set_messagetype(type);
+	}
+	return tmpPacket;
 }
 
 void
@@ -195,6 +265,8 @@ ServerGame::RemoveAllSessions()
 	// Clean up ALL sessions which are left.
 	GetSessionManager().ForEach(&SessionData::Close);
 	GetSessionManager().Clear();
+	m_spectatorFeed.Clear();
+	InvalidateGameListPacket();
 	SetState(ServerGameStateFinal::Instance());
 }
 
@@ -337,6 +409,8 @@ ServerGame::InternalStartGame()
 
 		GuiInterface &gui = GetGui();
 		m_game.reset(new Game(&gui, factory, playerData, GetGameData(), GetStartData(), GetNextGameNum(), NULL));
+		m_rejoinSnapshot.reset();
+		InvalidateGameListPacket();
 
 		GetDatabase().AsyncCreateGame(GetId(), GetName());
 		InitRankingMap(playerData);
@@ -457,6 +531,8 @@ ServerGame::InternalEndGame()
 {
 	StoreAndResetRanking();
 	m_game.reset();
+	m_rejoinSnapshot.reset();
+	InvalidateGameListPacket();
 }
 
 void
@@ -700,6 +776,7 @@ void
 ServerGame::SetAdminPlayerId(unsigned playerId)
 {
 	m_adminPlayerId = playerId;
+	InvalidateGameListPacket();
 }
 
 void
@@ -803,6 +880,7 @@ ServerGame::AddComputerPlayer(boost::shared_ptr<PlayerData> player)
 		boost::mutex::scoped_lock lock(m_computerPlayerListMutex);
 		m_computerPlayerList.push_back(player);
 	}
+	InvalidateGameListPacket();
 	GetLobbyThread().AddComputerPlayer(player);
 }
 
@@ -823,6 +901,7 @@ ServerGame::RemoveComputerPlayer(unsigned playerId)
 			++i;
 		}
 	}
+	InvalidateGameListPacket();
 	GetLobbyThread().RemoveComputerPlayer(tmpPlayer);
 	return tmpPlayer;
 }
@@ -845,6 +924,7 @@ ServerGame::IsComputerPlayerActive(unsigned playerId) const
 void
 ServerGame::ResetComputerPlayerList()
 {
+	InvalidateGameListPacket();
 	boost::mutex::scoped_lock lock(m_computerPlayerListMutex);
 
 	PlayerDataList::iterator i = m_computerPlayerList.begin();
@@ -866,6 +946,8 @@ ServerGame::RemoveSession(boost::shared_ptr<SessionData> session, int reason)
 		throw ServerException(__FILE__, __LINE__, ERR_NET_INVALID_SESSION, 0);
 
 	if (GetSessionManager().RemoveSession(session->GetId())) {
+		m_spectatorFeed.RemoveSpectator(session->GetId());
+		InvalidateGameListPacket();
 		boost::shared_ptr<PlayerData> tmpPlayerData = session->GetPlayerData();
 		if (tmpPlayerData && !tmpPlayerData->GetName().empty()) {
 			RemovePlayerData(tmpPlayerData, reason, session->GetState() == SessionData::Spectating || session->GetState() == SessionData::SpectatorWaiting);
@@ -924,7 +1006,7 @@ ServerGame::RemovePlayerData(boost::shared_ptr<PlayerData> player, int reason, b
 		netPlayerLeft->set_playerid(player->GetUniqueId());
 		netPlayerLeft->set_gameplayerleftreason(netReason);
 	}
-	GetSessionManager().SendToAllSessions(GetLobbyThread().GetSender(), thisPlayerLeft, SessionData::Game | SessionData::Spectating | SessionData::SpectatorWaiting);
+	SendToAllPlayers(thisPlayerLeft, SessionData::Game | SessionData::Spectating | SessionData::SpectatorWaiting);
 
 	GetState().NotifySessionRemoved(shared_from_this());
 	if (spectateOnly) {
@@ -1072,13 +1154,13 @@ ServerGame::SetState(ServerGameState &newState)
 	m_curState->Enter(shared_from_this());
 }
 
-boost::asio::deadline_timer &
+GameTimer &
 ServerGame::GetStateTimer1()
 {
 	return m_stateTimer1;
 }
 
-boost::asio::deadline_timer &
+GameTimer &
 ServerGame::GetStateTimer2()
 {
 	return m_stateTimer2;
@@ -33,6 +33,7 @@
 #include <net/servergame.h>
 #include <net/serverlobbythread.h>
 #include <net/senderhelper.h>
+#include <net/sessiontimerwheel.h>
 #include <net/netpacket.h>
 #include <net/socket_msg.h>
 #include <net/serverexception.h>
@@ -91,8 +92,7 @@ static void SendPlayerAction(ServerGame &server, boost::shared_ptr<PlayerInterfa
 	if (!player.get())
 		throw ServerException(__FILE__, __LINE__, ERR_NET_NO_CURRENT_PLAYER, 0);
 
-	boost::shared_ptr<NetPacket> packet(new NetPacket);
-	packet->GetMsg()->set_messagetype(PokerTHMessage::Type_PlayersActionDoneMessage);
+	boost::shared_ptr<NetPacket> packet(server.GetHandPacket(PokerTHMessage::Type_PlayersActionDoneMessage));
 	PlayersActionDoneMessage *netActionDone = packet->GetMsg()->mutable_playersactiondonemessage();
 
 	netActionDone->set_gameid(server.GetId());
@@ -116,8 +116,7 @@ static void SendNewRoundCards(ServerGame &server, Game &curGame, int state)
 	} break;
 	case GAME_STATE_FLOP: {
 		// deal flop cards
-		boost::shared_ptr<NetPacket> packet(new NetPacket);
-		packet->GetMsg()->set_messagetype(PokerTHMessage::Type_DealFlopCardsMessage);
+		boost::shared_ptr<NetPacket> packet(server.GetHandPacket(PokerTHMessage::Type_DealFlopCardsMessage));
 		DealFlopCardsMessage *netDealFlop = packet->GetMsg()->mutable_dealflopcardsmessage();
 		netDealFlop->set_gameid(server.GetId());
 		netDealFlop->set_flopcard1(cards[0]);
@@ -128,8 +127,7 @@ static void SendNewRoundCards(ServerGame &server, Game &curGame, int state)
 	break;
 	case GAME_STATE_TURN: {
 		// deal turn card
-		boost::shared_ptr<NetPacket> packet(new NetPacket);
-		packet->GetMsg()->set_messagetype(PokerTHMessage::Type_DealTurnCardMessage);
+		boost::shared_ptr<NetPacket> packet(server.GetHandPacket(PokerTHMessage::Type_DealTurnCardMessage));
 		DealTurnCardMessage *netDealTurn = packet->GetMsg()->mutable_dealturncardmessage();
 		netDealTurn->set_gameid(server.GetId());
 		netDealTurn->set_turncard(cards[3]);
@@ -138,8 +136,7 @@ static void SendNewRoundCards(ServerGame &server, Game &curGame, int state)
 	break;
 	case GAME_STATE_RIVER: {
 		// deal river card
-		boost::shared_ptr<NetPacket> packet(new NetPacket);
-		packet->GetMsg()->set_messagetype(PokerTHMessage::Type_DealRiverCardMessage);
+		boost::shared_ptr<NetPacket> packet(server.GetHandPacket(PokerTHMessage::Type_DealRiverCardMessage));
 		DealRiverCardMessage *netDealRiver = packet->GetMsg()->mutable_dealrivercardmessage();
 		netDealRiver->set_gameid(server.GetId());
 		netDealRiver->set_rivercard(cards[4]);
@@ -235,7 +232,7 @@ void
 AbstractServerGameStateReceiving::ProcessPacket(boost::shared_ptr<ServerGame> server, boost::shared_ptr<SessionData> session, boost::shared_ptr<NetPacket> packet)
 {
 	if (packet->IsClientActivity()) {
-		session->ResetActivityTimer();
+		server->GetLobbyThread().GetSessionTimers().ResetActivityTimeout(session->GetId());
 	}
 	if (packet->GetMsg()->messagetype() == PokerTHMessage::Type_PlayerInfoRequestMessage) {
 		// Delegate to Lobby.
@@ -412,13 +409,13 @@ AbstractServerGameStateReceiving::CreateNetPacketJoinGameAck(const ServerGame &s
 }
 
 boost::shared_ptr<NetPacket>
-AbstractServerGameStateReceiving::CreateNetPacketHandStart(const ServerGame &server)
+AbstractServerGameStateReceiving::CreateNetPacketHandStart(ServerGame &server)
 {
 	const Game &curGame = server.GetGame();
 
-	boost::shared_ptr<NetPacket> notifyCards(new NetPacket);
-	notifyCards->GetMsg()->set_messagetype(PokerTHMessage::Type_HandStartMessage);
+	boost::shared_ptr<NetPacket> notifyCards(server.GetHandPacket(PokerTHMessage::Type_HandStartMessage));
 	HandStartMessage *netHandStart = notifyCards->GetMsg()->mutable_handstartmessage();
+	netHandStart->Clear();
 	netHandStart->set_gameid(server.GetId());
 
 	PlayerListIterator player_i = curGame.getSeatsList()->begin();
@@ -479,6 +476,9 @@ AbstractServerGameStateReceiving::AcceptNewSession(boost::shared_ptr<ServerGame>
 
 	// Accept session.
 	server->GetSessionManager().AddSession(session);
+	server->InvalidateGameListPacket();
+	if (spectateOnly)
+		server->AddFeedSpectator(session->GetId());
 
 	// Notify lobby.
 	if (spectateOnly) {
@@ -569,9 +569,8 @@ ServerGameStateInit::RegisterAdminTimer(boost::shared_ptr<ServerGame> server)
 {
 	// No admin timeout in LAN or ranking games.
 	if (server->GetLobbyThread().GetServerMode() != SERVER_MODE_LAN && server->GetGameData().gameType != GAME_TYPE_RANKING) {
-		server->GetStateTimer1().expires_from_now(
-			boost::posix_time::seconds(SERVER_GAME_ADMIN_TIMEOUT_SEC - SERVER_GAME_ADMIN_WARNING_REMAINING_SEC));
-		server->GetStateTimer1().async_wait(
+		server->GetStateTimer1().Start(
+			boost::posix_time::seconds(SERVER_GAME_ADMIN_TIMEOUT_SEC - SERVER_GAME_ADMIN_WARNING_REMAINING_SEC),
 			boost::bind(
 				&ServerGameStateInit::TimerAdminWarning, this, boost::asio::placeholders::error, server));
 	}
@@ -580,7 +579,7 @@ ServerGameStateInit::RegisterAdminTimer(boost::shared_ptr<ServerGame> server)
 void
 ServerGameStateInit::UnregisterAdminTimer(boost::shared_ptr<ServerGame> server)
 {
-	server->GetStateTimer1().cancel();
+	server->GetStateTimer1().Cancel();
 }
 
 void
@@ -588,9 +587,8 @@ ServerGameStateInit::RegisterAutoStartTimer(boost::shared_ptr<ServerGame> server
 {
 	// No autostart in LAN games.
 	if (server->GetLobbyThread().GetServerMode() != SERVER_MODE_LAN) {
-		server->GetStateTimer2().expires_from_now(
-			boost::posix_time::seconds(SERVER_AUTOSTART_GAME_DELAY_SEC));
-		server->GetStateTimer2().async_wait(
+		server->GetStateTimer2().Start(
+			boost::posix_time::seconds(SERVER_AUTOSTART_GAME_DELAY_SEC),
 			boost::bind(
 				&ServerGameStateInit::TimerAutoStart, this, boost::asio::placeholders::error, server));
 	}
@@ -599,7 +597,7 @@ ServerGameStateInit::RegisterAutoStartTimer(boost::shared_ptr<ServerGame> server
 void
 ServerGameStateInit::UnregisterAutoStartTimer(boost::shared_ptr<ServerGame> server)
 {
-	server->GetStateTimer2().cancel();
+	server->GetStateTimer2().Cancel();
 }
 
 void
@@ -626,9 +624,8 @@ ServerGameStateInit::TimerAdminWarning(const boost::system::error_code &ec, boos
 			server->GetLobbyThread().GetSender().Send(session, packet);
 		}
 		// Start timeout timer.
-		server->GetStateTimer1().expires_from_now(
-			boost::posix_time::seconds(SERVER_GAME_ADMIN_WARNING_REMAINING_SEC));
-		server->GetStateTimer1().async_wait(
+		server->GetStateTimer1().Start(
+			boost::posix_time::seconds(SERVER_GAME_ADMIN_WARNING_REMAINING_SEC),
 			boost::bind(
 				&ServerGameStateInit::TimerAdminTimeout, this, boost::asio::placeholders::error, server));
 	}
@@ -761,9 +758,8 @@ ServerGameStateStartGame::~ServerGameStateStartGame()
 void
 ServerGameStateStartGame::Enter(boost::shared_ptr<ServerGame> server)
 {
-	server->GetStateTimer1().expires_from_now(
-		boost::posix_time::seconds(SERVER_START_GAME_TIMEOUT_SEC));
-	server->GetStateTimer1().async_wait(
+	server->GetStateTimer1().Start(
+		boost::posix_time::seconds(SERVER_START_GAME_TIMEOUT_SEC),
 		boost::bind(
 			&ServerGameStateStartGame::TimerTimeout, this, boost::asio::placeholders::error, server));
 }
@@ -771,7 +767,7 @@ ServerGameStateStartGame::Enter(boost::shared_ptr<ServerGame> server)
 void
 ServerGameStateStartGame::Exit(boost::shared_ptr<ServerGame> server)
 {
-	server->GetStateTimer1().cancel();
+	server->GetStateTimer1().Cancel();
 }
 
 void
@@ -924,9 +920,8 @@ ServerGameStateHand::~ServerGameStateHand()
 void
 ServerGameStateHand::Enter(boost::shared_ptr<ServerGame> server)
 {
-	server->GetStateTimer1().expires_from_now(
-		boost::posix_time::milliseconds(SERVER_LOOP_DELAY_MSEC));
-	server->GetStateTimer1().async_wait(
+	server->GetStateTimer1().Start(
+		boost::posix_time::milliseconds(SERVER_LOOP_DELAY_MSEC),
 		boost::bind(
 			&ServerGameStateHand::TimerLoop, this, boost::asio::placeholders::error, server));
 }
@@ -934,7 +929,7 @@ ServerGameStateHand::Enter(boost::shared_ptr<ServerGame> server)
 void
 ServerGameStateHand::Exit(boost::shared_ptr<ServerGame> server)
 {
-	server->GetStateTimer1().cancel();
+	server->GetStateTimer1().Cancel();
 }
 
 void
@@ -947,6 +942,7 @@ void
 ServerGameStateHand::TimerLoop(const boost::system::error_code &ec, boost::shared_ptr<ServerGame> server)
 {
 	if (!ec && &server->GetState() == this) {
+		SenderBatch batch(server->GetLobbyThread().GetSender());
 		try {
 			EngineLoop(server);
 		} catch (const PokerTHException &e) {
@@ -958,8 +954,17 @@ ServerGameStateHand::TimerLoop(const boost::system::error_code &ec, boost::share
 
 void
 ServerGameStateHand::EngineLoop(boost::shared_ptr<ServerGame> server)
+{
+	// Steps which need no pacing are run at once, within the current send batch.
+	while (EngineStep(server)) {
+	}
+}
+
+bool
+ServerGameStateHand::EngineStep(boost::shared_ptr<ServerGame> server)
 {
 	Game &curGame = server->GetGame();
+	bool fastForward = IsFastForward(*server);
 
 	// Main game loop.
 	int curRound = curGame.getCurrentHand()->getCurrentRound();
@@ -1001,17 +1006,21 @@ ServerGameStateHand::EngineLoop(boost::shared_ptr<ServerGame> server)
 			server->SendToAllPlayers(allIn, SessionData::Game | SessionData::Spectating);
 			curGame.getCurrentHand()->setCardsShown(true);
 
-			server->GetStateTimer1().expires_from_now(
-				boost::posix_time::seconds(SERVER_SHOW_CARDS_DELAY_SEC));
-			server->GetStateTimer1().async_wait(
+			if (fastForward) {
+				SendNewRoundCards(*server, curGame, newRound);
+				return true;
+			}
+			server->GetStateTimer1().Start(
+				boost::posix_time::seconds(SERVER_SHOW_CARDS_DELAY_SEC),
 				boost::bind(
 					&ServerGameStateHand::TimerShowCards, this, boost::asio::placeholders::error, server));
 		} else {
 			SendNewRoundCards(*server, curGame, newRound);
 
-			server->GetStateTimer1().expires_from_now(
-				boost::posix_time::seconds(GetDealCardsDelaySec(*server)));
-			server->GetStateTimer1().async_wait(
+			if (fastForward)
+				return true;
+			server->GetStateTimer1().Start(
+				boost::posix_time::seconds(GetDealCardsDelaySec(*server)),
 				boost::bind(
 					&ServerGameStateHand::TimerLoop, this, boost::asio::placeholders::error, server));
 		}
@@ -1027,8 +1036,7 @@ ServerGameStateHand::EngineLoop(boost::shared_ptr<ServerGame> server)
 			if (!curPlayer->getMyActiveStatus())
 				throw ServerException(__FILE__, __LINE__, ERR_NET_PLAYER_NOT_ACTIVE, 0);
 
-			boost::shared_ptr<NetPacket> notification(new NetPacket);
-			notification->GetMsg()->set_messagetype(PokerTHMessage::Type_PlayersTurnMessage);
+			boost::shared_ptr<NetPacket> notification(server->GetHandPacket(PokerTHMessage::Type_PlayersTurnMessage));
 			PlayersTurnMessage *netPlayersTurn = notification->GetMsg()->mutable_playersturnmessage();
 			netPlayersTurn->set_gameid(server->GetId());
 			netPlayersTurn->set_gamestate(static_cast<NetGameState>(curGame.getCurrentHand()->getCurrentRound()));
@@ -1037,9 +1045,13 @@ ServerGameStateHand::EngineLoop(boost::shared_ptr<ServerGame> server)
 
 			// If the player is computer controlled, let the engine act.
 			if (curPlayer->getMyType() == PLAYER_TYPE_COMPUTER) {
-				server->GetStateTimer1().expires_from_now(
-					boost::posix_time::seconds(SERVER_COMPUTER_ACTION_DELAY_SEC));
-				server->GetStateTimer1().async_wait(
+				if (fastForward) {
+					curPlayer->action();
+					SendPlayerAction(*server, curPlayer);
+					return true;
+				}
+				server->GetStateTimer1().Start(
+					boost::posix_time::seconds(SERVER_COMPUTER_ACTION_DELAY_SEC),
 					boost::bind(
 						&ServerGameStateHand::TimerComputerAction, this, boost::asio::placeholders::error, server));
 			} else {
@@ -1048,9 +1060,10 @@ ServerGameStateHand::EngineLoop(boost::shared_ptr<ServerGame> server)
 						|| !curPlayer->isSessionActive()) {
 					PerformPlayerAction(*server, curPlayer, PLAYER_ACTION_FOLD, 0);
 
-					server->GetStateTimer1().expires_from_now(
-						boost::posix_time::milliseconds(SERVER_LOOP_DELAY_MSEC));
-					server->GetStateTimer1().async_wait(
+					if (fastForward)
+						return true;
+					server->GetStateTimer1().Start(
+						boost::posix_time::milliseconds(SERVER_LOOP_DELAY_MSEC),
 						boost::bind(
 							&ServerGameStateHand::TimerLoop, this, boost::asio::placeholders::error, server));
 				} else {
@@ -1116,9 +1129,8 @@ ServerGameStateHand::EngineLoop(boost::shared_ptr<ServerGame> server)
 				server->InternalEndGame();
 
 				// View a dialog for a new game - delayed.
-				server->GetStateTimer1().expires_from_now(
-					boost::posix_time::seconds(SERVER_DELAY_NEXT_GAME_SEC));
-				server->GetStateTimer1().async_wait(
+				server->GetStateTimer1().Start(
+					boost::posix_time::seconds(SERVER_DELAY_NEXT_GAME_SEC),
 					boost::bind(
 						&ServerGameStateHand::TimerNextGame, this, boost::asio::placeholders::error, server, winnerPlayer->getMyUniqueID()));
 			} else {
@@ -1126,18 +1138,19 @@ ServerGameStateHand::EngineLoop(boost::shared_ptr<ServerGame> server)
 			}
 		}
 	}
+	return false;
 }
 
 void
 ServerGameStateHand::TimerShowCards(const boost::system::error_code &ec, boost::shared_ptr<ServerGame> server)
 {
 	if (!ec && &server->GetState() == this) {
+		SenderBatch batch(server->GetLobbyThread().GetSender());
 		Game &curGame = server->GetGame();
 		SendNewRoundCards(*server, curGame, curGame.getCurrentHand()->getCurrentRound());
 
-		server->GetStateTimer1().expires_from_now(
-			boost::posix_time::seconds(GetDealCardsDelaySec(*server)));
-		server->GetStateTimer1().async_wait(
+		server->GetStateTimer1().Start(
+			boost::posix_time::seconds(GetDealCardsDelaySec(*server)),
 			boost::bind(
 				&ServerGameStateHand::TimerLoop, this, boost::asio::placeholders::error, server));
 	}
@@ -1147,6 +1160,7 @@ void
 ServerGameStateHand::TimerComputerAction(const boost::system::error_code &ec, boost::shared_ptr<ServerGame> server)
 {
 	if (!ec && &server->GetState() == this) {
+		SenderBatch batch(server->GetLobbyThread().GetSender());
 		try {
 			boost::shared_ptr<PlayerInterface> curPlayer = server->GetGame().getCurrentPlayer();
 			if (!curPlayer)
@@ -1166,6 +1180,7 @@ void
 ServerGameStateHand::TimerNextHand(const boost::system::error_code &ec, boost::shared_ptr<ServerGame> server)
 {
 	if (!ec && &server->GetState() == this) {
+		SenderBatch batch(server->GetLobbyThread().GetSender());
 		StartNewHand(server);
 		TimerLoop(ec, server);
 	}
@@ -1190,6 +1205,31 @@ ServerGameStateHand::TimerNextGame(const boost::system::error_code &ec, boost::s
 	}
 }
 
+bool
+ServerGameStateHand::IsFastForward(ServerGame &server)
+{
+	if (!server.GetLobbyThread().IsFastForwardEnabled())
+		return false;
+	SessionManager &sessionManager = server.GetSessionManager();
+	// Spectators need to opt in to fast forwarding.
+	if (!sessionManager.IsFastForwardAcceptedByAll(SessionData::Spectating))
+		return false;
+	// Connected human players who are still in the hand always get the paced
+	// hand. Players who are out or were auto-folded need to opt in as well.
+	PlayerList seatsList = server.GetGame().getSeatsList();
+	PlayerListConstIterator i = seatsList->begin();
+	PlayerListConstIterator end = seatsList->end();
+	while (i != end) {
+		if ((*i)->getMyType() == PLAYER_TYPE_HUMAN) {
+			boost::shared_ptr<SessionData> session = sessionManager.GetSessionByUniquePlayerId((*i)->getMyUniqueID());
+			if (session && (((*i)->getMyActiveStatus() && (*i)->isSessionActive()) || !session->IsFastForwardAccepted()))
+				return false;
+		}
+		++i;
+	}
+	return true;
+}
+
 int
 ServerGameStateHand::GetDealCardsDelaySec(ServerGame &server)
 {
@@ -1243,6 +1283,10 @@ ServerGameStateHand::StartNewHand(boost::shared_ptr<ServerGame> server)
 	PlayerListIterator i = curGame.getSeatsList()->begin();
 	PlayerListIterator end = curGame.getSeatsList()->end();
 
+	// The seat states are the same for all players, only the cards are patched.
+	boost::shared_ptr<NetPacket> notifyCards = CreateNetPacketHandStart(*server);
+	HandStartMessage *netHandStart = notifyCards->GetMsg()->mutable_handstartmessage();
+
 	// Send cards to all players.
 	while (i != end) {
 		// Also send to inactive players.
@@ -1253,8 +1297,8 @@ ServerGameStateHand::StartNewHand(boost::shared_ptr<ServerGame> server)
 			bool errorFlag = false;
 			tmpPlayer->getMyCards(cards);
 
-			boost::shared_ptr<NetPacket> notifyCards = CreateNetPacketHandStart(*server);
-			HandStartMessage *netHandStart = notifyCards->GetMsg()->mutable_handstartmessage();
+			netHandStart->clear_plaincards();
+			netHandStart->clear_encryptedcards();
 			string tmpPassword(tmpSession->AuthGetPassword());
 			if (tmpPassword.empty()) { // encrypt only if password is present
 				HandStartMessage::PlainCards *plainCards = netHandStart->mutable_plaincards();
@@ -1287,7 +1331,9 @@ ServerGameStateHand::StartNewHand(boost::shared_ptr<ServerGame> server)
 		}
 		++i;
 	}
-	server->SendToAllPlayers(CreateNetPacketHandStart(*server), SessionData::Spectating);
+	netHandStart->clear_plaincards();
+	netHandStart->clear_encryptedcards();
+	server->SendToAllPlayers(notifyCards, SessionData::Spectating);
 
 	// Start hand.
 	curGame.startHand();
@@ -1299,8 +1345,7 @@ ServerGameStateHand::StartNewHand(boost::shared_ptr<ServerGame> server)
 	while (i != end) {
 		boost::shared_ptr<PlayerInterface> tmpPlayer = *i;
 		if (tmpPlayer->getMyButton() == BUTTON_SMALL_BLIND) {
-			boost::shared_ptr<NetPacket> notifySmallBlind(new NetPacket);
-			notifySmallBlind->GetMsg()->set_messagetype(PokerTHMessage::Type_PlayersActionDoneMessage);
+			boost::shared_ptr<NetPacket> notifySmallBlind(server->GetHandPacket(PokerTHMessage::Type_PlayersActionDoneMessage));
 			PlayersActionDoneMessage *netSmallBlind = notifySmallBlind->GetMsg()->mutable_playersactiondonemessage();
 			netSmallBlind->set_gameid(server->GetId());
 			netSmallBlind->set_gamestate(netStatePreflopSmallBlind);
@@ -1321,8 +1366,7 @@ ServerGameStateHand::StartNewHand(boost::shared_ptr<ServerGame> server)
 	while (i != end) {
 		boost::shared_ptr<PlayerInterface> tmpPlayer = *i;
 		if (tmpPlayer->getMyButton() == BUTTON_BIG_BLIND) {
-			boost::shared_ptr<NetPacket> notifyBigBlind(new NetPacket);
-			notifyBigBlind->GetMsg()->set_messagetype(PokerTHMessage::Type_PlayersActionDoneMessage);
+			boost::shared_ptr<NetPacket> notifyBigBlind(server->GetHandPacket(PokerTHMessage::Type_PlayersActionDoneMessage));
 			PlayersActionDoneMessage *netBigBlind = notifyBigBlind->GetMsg()->mutable_playersactiondonemessage();
 			netBigBlind->set_gameid(server->GetId());
 			netBigBlind->set_gamestate(netStatePreflopBigBlind);
@@ -1416,7 +1460,8 @@ ServerGameStateHand::InitNewSpectators(boost::shared_ptr<ServerGame> server)
 		boost::shared_ptr<SessionData> session(server->GetSessionManager().GetSessionByUniquePlayerId(*i));
 		if (session && session->GetPlayerData()) {
 			session->SetState(SessionData::Spectating);
-			SendGameData(server, session);
+			// The game data is part of the (delayed) spectator feed.
+			server->AddFeedSpectator(session->GetId(), GetRejoinSnapshot(*server));
 		}
 		++i;
 	}
@@ -1439,6 +1484,7 @@ ServerGameStateHand::PerformRejoin(boost::shared_ptr<ServerGame> server, boost::
 
 		// Update the dealer, if necessary.
 		curGame.replaceDealer(rejoinPlayer->getMyUniqueID(), session->GetPlayerData()->GetUniqueId());
+		PatchRejoinSnapshot(*server, rejoinPlayer->getMyUniqueID(), session->GetPlayerData()->GetUniqueId());
 		// Update the ranking map.
 		server->ReplaceRankingPlayer(rejoinPlayer->getMyUniqueID(), session->GetPlayerData()->GetUniqueId());
 		// Change the Id in the poker engine.
@@ -1455,27 +1501,55 @@ ServerGameStateHand::PerformRejoin(boost::shared_ptr<ServerGame> server, boost::
 void
 ServerGameStateHand::SendGameData(boost::shared_ptr<ServerGame> server, boost::shared_ptr<SessionData> session)
 {
-	Game &curGame = server->GetGame();
 	// Send game start notification to rejoining client.
-	boost::shared_ptr<NetPacket> packet(new NetPacket);
-	packet->GetMsg()->set_messagetype(PokerTHMessage::Type_GameStartRejoinMessage);
-	GameStartRejoinMessage *netGameStart = packet->GetMsg()->mutable_gamestartrejoinmessage();
-	netGameStart->set_gameid(server->GetId());
-	netGameStart->set_startdealerplayerid(curGame.getDealerPosition());
-	netGameStart->set_handnum(curGame.getCurrentHandID());
-	PlayerListIterator player_i = curGame.getSeatsList()->begin();
-	PlayerListIterator player_end = curGame.getSeatsList()->end();
-	int player_count = 0;
-	while (player_i != player_end && player_count < server->GetStartData().numberOfPlayers) {
-		boost::shared_ptr<PlayerInterface> tmpPlayer = *player_i;
-		GameStartRejoinMessage::RejoinPlayerData *playerSlot = netGameStart->add_rejoinplayerdata();
-		playerSlot->set_playerid(tmpPlayer->getMyUniqueID());
-		playerSlot->set_playermoney(tmpPlayer->getMyCash());
-		++player_i;
-		++player_count;
+	server->GetLobbyThread().GetSender().Send(session, GetRejoinSnapshot(*server));
+}
+
+boost::shared_ptr<NetPacket>
+ServerGameStateHand::GetRejoinSnapshot(ServerGame &server)
+{
+	Game &curGame = server.GetGame();
+	if (!server.m_rejoinSnapshot || server.m_rejoinSnapshotHandId != curGame.getCurrentHandID()) {
+		boost::shared_ptr<NetPacket> packet(new NetPacket);
+		packet->GetMsg()->set_messagetype(PokerTHMessage::Type_GameStartRejoinMessage);
+		GameStartRejoinMessage *netGameStart = packet->GetMsg()->mutable_gamestartrejoinmessage();
+		netGameStart->set_gameid(server.GetId());
+		netGameStart->set_startdealerplayerid(curGame.getDealerPosition());
+		netGameStart->set_handnum(curGame.getCurrentHandID());
+		PlayerListIterator player_i = curGame.getSeatsList()->begin();
+		PlayerListIterator player_end = curGame.getSeatsList()->end();
+		int player_count = 0;
+		while (player_i != player_end && player_count < server.GetStartData().numberOfPlayers) {
+			boost::shared_ptr<PlayerInterface> tmpPlayer = *player_i;
+			GameStartRejoinMessage::RejoinPlayerData *playerSlot = netGameStart->add_rejoinplayerdata();
+			playerSlot->set_playerid(tmpPlayer->getMyUniqueID());
+			playerSlot->set_playermoney(tmpPlayer->getMyCash());
+			++player_i;
+			++player_count;
+		}
+		server.m_rejoinSnapshot = packet;
+		server.m_rejoinSnapshotHandId = curGame.getCurrentHandID();
 	}
+	return server.m_rejoinSnapshot;
+}
 
-	server->GetLobbyThread().GetSender().Send(session, packet);
+void
+ServerGameStateHand::PatchRejoinSnapshot(ServerGame &server, unsigned oldPlayerId, unsigned newPlayerId)
+{
+	if (server.m_rejoinSnapshot) {
+		if (!server.m_rejoinSnapshot.unique()) {
+			// Still referenced by a send queue, build a new one when needed.
+			server.m_rejoinSnapshot.reset();
+		} else {
+			GameStartRejoinMessage *netGameStart = server.m_rejoinSnapshot->GetMsg()->mutable_gamestartrejoinmessage();
+			if (netGameStart->startdealerplayerid() == oldPlayerId)
+				netGameStart->set_startdealerplayerid(newPlayerId);
+			for (int i = 0; i < netGameStart->rejoinplayerdata_size(); i++) {
+				if (netGameStart->rejoinplayerdata(i).playerid() == oldPlayerId)
+					netGameStart->mutable_rejoinplayerdata(i)->set_playerid(newPlayerId);
+			}
+		}
+	}
 }
 
 //-----------------------------------------------------------------------------
@@ -1507,8 +1581,8 @@ ServerGameStateWaitPlayerAction::Enter(boost::shared_ptr<ServerGame> server)
 		int timeoutSec = server->GetGameData().playerActionTimeoutSec + SERVER_PLAYER_TIMEOUT_ADD_DELAY_SEC;
 #endif
 
-		server->GetStateTimer1().expires_from_now(boost::posix_time::seconds(timeoutSec));
-		server->GetStateTimer1().async_wait(
+		server->GetStateTimer1().Start(
+			boost::posix_time::seconds(timeoutSec),
 			boost::bind(
 				&ServerGameStateWaitPlayerAction::TimerTimeout, this, boost::asio::placeholders::error, server));
 	}
@@ -1517,7 +1591,7 @@ ServerGameStateWaitPlayerAction::Enter(boost::shared_ptr<ServerGame> server)
 void
 ServerGameStateWaitPlayerAction::Exit(boost::shared_ptr<ServerGame> server)
 {
-	server->GetStateTimer1().cancel();
+	server->GetStateTimer1().Cancel();
 }
 
 void
@@ -1591,6 +1665,7 @@ void
 ServerGameStateWaitPlayerAction::TimerTimeout(const boost::system::error_code &ec, boost::shared_ptr<ServerGame> server)
 {
 	if (!ec && &server->GetState() == this) {
+		SenderBatch batch(server->GetLobbyThread().GetSender());
 		try {
 			Game &curGame = server->GetGame();
 			// Retrieve current player.
@@ -1640,10 +1715,8 @@ ServerGameStateWaitNextHand::Enter(boost::shared_ptr<ServerGame> server)
 	int timeoutSec = server->GetGameData().delayBetweenHandsSec;
 #endif
 
-	server->GetStateTimer1().expires_from_now(
-		boost::posix_time::seconds(timeoutSec));
-
-	server->GetStateTimer1().async_wait(
+	server->GetStateTimer1().Start(
+		boost::posix_time::seconds(timeoutSec),
 		boost::bind(
 			&ServerGameStateWaitNextHand::TimerTimeout, this, boost::asio::placeholders::error, server));
 }
@@ -1651,7 +1724,7 @@ ServerGameStateWaitNextHand::Enter(boost::shared_ptr<ServerGame> server)
 void
 ServerGameStateWaitNextHand::Exit(boost::shared_ptr<ServerGame> server)
 {
-	server->GetStateTimer1().cancel();
+	server->GetStateTimer1().Cancel();
 }
 
 void
@@ -1677,6 +1750,7 @@ void
 ServerGameStateWaitNextHand::TimerTimeout(const boost::system::error_code &ec, boost::shared_ptr<ServerGame> server)
 {
 	if (!ec && &server->GetState() == this) {
+		SenderBatch batch(server->GetLobbyThread().GetSender());
 		ServerGameStateHand::StartNewHand(server);
 		server->SetState(ServerGameStateHand::Instance());
 	}
@@ -32,9 +32,12 @@
 #include <net/serverlobbythread.h>
 #include <net/servergame.h>
 #include <net/serverbanmanager.h>
+#include <net/serverconnectlimiter.h>
 #include <net/serverexception.h>
 #include <net/receivebuffer.h>
 #include <net/senderhelper.h>
+#include <net/sessiontimerwheel.h>
+#include <net/gametimerwheel.h>
 #include <net/serverircbotcallback.h>
 #include <net/socket_msg.h>
 #include <net/chatcleanermanager.h>
@@ -118,6 +121,10 @@ public:
 		m_server.DispatchPacket(session, packet);
 	}
 
+	virtual void HandlePacketBatch(boost::shared_ptr<SessionData> session, const NetPacketList &packetList) {
+		m_server.DispatchPacketBatch(session, packetList);
+	}
+
 	virtual void SignalChatBotMessage(const string &msg) {
 		m_server.SendChatBotMsg(msg);
 	}
@@ -221,12 +228,19 @@ ServerLobbyThread::ServerLobbyThread(GuiInterface &gui, ServerMode mode, ServerI
 	: m_ioService(ioService), m_authContext(NULL), m_gui(gui), m_ircBotCb(ircBotCb), m_avatarManager(avatarManager),
 	  m_mode(mode), m_serverConfig(serverConfig), m_curGameId(0), m_curUniquePlayerId(0), m_curSessionId(INVALID_SESSION + 1),
 	  m_statDataChanged(false), m_removeGameTimer(*ioService),
-	  m_saveStatisticsTimer(*ioService), m_loginLockTimer(*ioService),
+	  m_saveStatisticsTimer(*ioService), m_loginLockTimer(*ioService), m_lobbyNotifyTimer(*ioService),
+	  m_lobbyNotifyIntervalMsec(serverConfig.readConfigInt("ServerLobbyNotifyInterval")),
+	  m_fastForwardGames(serverConfig.readConfigInt("ServerFastForwardGames") != 0),
+	  m_spectatorDelaySec(serverConfig.readConfigInt("ServerSpectatorDelay")),
 	  m_startTime(boost::posix_time::second_clock::local_time())
 {
 	m_internalServerCallback.reset(new InternalServerCallback(*this));
 	m_sender.reset(new SenderHelper(m_ioService));
+	m_sessionTimers.reset(new SessionTimerWheel(m_ioService, *m_internalServerCallback));
+	m_gameTimers.reset(new GameTimerWheel(m_ioService));
 	m_banManager.reset(new ServerBanManager(m_ioService));
+	if (serverConfig.readConfigInt("ServerBruteForceProtection") != 0)
+		m_connectLimiter.reset(new ServerConnectLimiter);
 	m_chatCleanerManager.reset(new ChatCleanerManager(*m_internalServerCallback, m_ioService));
 	DBFactory dbFactory;
 	m_database = dbFactory.CreateServerDBObject(*m_internalServerCallback, m_ioService);
@@ -274,9 +288,9 @@ ServerLobbyThread::AddConnection(boost::shared_ptr<SessionData> sessionData)
 
 	LOG_VERBOSE("Accepted connection - session #" << sessionData->GetId() << ".");
 
-	sessionData->StartTimerInitTimeout(SERVER_INIT_SESSION_TIMEOUT_SEC);
-	sessionData->StartTimerGlobalTimeout(SERVER_SESSION_FORCED_TIMEOUT_SEC);
-	sessionData->StartTimerActivityTimeout(SERVER_SESSION_ACTIVITY_TIMEOUT_SEC, SERVER_TIMEOUT_WARNING_REMAINING_SEC);
+	m_sessionTimers->StartInitTimeout(sessionData, SERVER_INIT_SESSION_TIMEOUT_SEC);
+	m_sessionTimers->StartGlobalTimeout(sessionData, SERVER_SESSION_FORCED_TIMEOUT_SEC);
+	m_sessionTimers->StartActivityTimeout(sessionData, SERVER_SESSION_ACTIVITY_TIMEOUT_SEC, SERVER_TIMEOUT_WARNING_REMAINING_SEC);
 
 	unsigned numLobbySessions = m_sessionManager.GetRawSessionCount();
 	unsigned numGameSessions = m_gameSessionManager.GetRawSessionCount();
@@ -284,7 +298,7 @@ ServerLobbyThread::AddConnection(boost::shared_ptr<SessionData> sessionData)
 			&& numLobbySessions + numGameSessions <= SERVER_MAX_NUM_TOTAL_SESSIONS) {
 		string ipAddress = sessionData->GetRemoteIPAddressFromSocket();
 		if (!ipAddress.empty()) {
-			sessionData->SetClientAddr(ipAddress);
+			m_sessionManager.SetSessionClientAddr(sessionData->GetId(), ipAddress);
 
 			boost::shared_ptr<NetPacket> packet(new NetPacket);
 			packet->GetMsg()->set_messagetype(PokerTHMessage::Type_AnnounceMessage);
@@ -409,7 +423,7 @@ ServerLobbyThread::CloseSession(boost::shared_ptr<SessionData> session)
 		// Close this session after send.
 		GetSender().SetCloseAfterSend(session);
 		// Cancel all timers of the session.
-		session->CancelTimers();
+		m_sessionTimers->CancelTimeouts(session->GetId());
 	}
 }
 
@@ -423,16 +437,14 @@ void
 ServerLobbyThread::NotifyPlayerJoinedLobby(unsigned playerId)
 {
 	boost::shared_ptr<NetPacket> notify = CreateNetPacketPlayerListNew(playerId);
-	m_sessionManager.SendLobbyMsgToAllSessions(GetSender(), notify, SessionData::Established);
-	m_gameSessionManager.SendLobbyMsgToAllSessions(GetSender(), notify, SessionData::Game | SessionData::Spectating | SessionData::SpectatorWaiting);
+	QueueLobbyNotification(notify);
 }
 
 void
 ServerLobbyThread::NotifyPlayerLeftLobby(unsigned playerId)
 {
 	boost::shared_ptr<NetPacket> notify = CreateNetPacketPlayerListLeft(playerId);
-	m_sessionManager.SendLobbyMsgToAllSessions(GetSender(), notify, SessionData::Established);
-	m_gameSessionManager.SendLobbyMsgToAllSessions(GetSender(), notify, SessionData::Game | SessionData::Spectating | SessionData::SpectatorWaiting);
+	QueueLobbyNotification(notify);
 }
 
 void
@@ -445,8 +457,7 @@ ServerLobbyThread::NotifyPlayerJoinedGame(unsigned gameId, unsigned playerId)
 	netListMsg->set_gameid(gameId);
 	netListMsg->set_playerid(playerId);
 
-	m_sessionManager.SendLobbyMsgToAllSessions(GetSender(), packet, SessionData::Established);
-	m_gameSessionManager.SendLobbyMsgToAllSessions(GetSender(), packet, SessionData::Game | SessionData::Spectating | SessionData::SpectatorWaiting);
+	QueueLobbyNotification(packet);
 }
 
 void
@@ -459,8 +470,7 @@ ServerLobbyThread::NotifyPlayerLeftGame(unsigned gameId, unsigned playerId)
 	netListMsg->set_gameid(gameId);
 	netListMsg->set_playerid(playerId);
 
-	m_sessionManager.SendLobbyMsgToAllSessions(GetSender(), packet, SessionData::Established);
-	m_gameSessionManager.SendLobbyMsgToAllSessions(GetSender(), packet, SessionData::Game | SessionData::Spectating | SessionData::SpectatorWaiting);
+	QueueLobbyNotification(packet);
 }
 
 void
@@ -473,8 +483,7 @@ ServerLobbyThread::NotifySpectatorJoinedGame(unsigned gameId, unsigned playerId)
 	netListMsg->set_gameid(gameId);
 	netListMsg->set_playerid(playerId);
 
-	m_sessionManager.SendLobbyMsgToAllSessions(GetSender(), packet, SessionData::Established);
-	m_gameSessionManager.SendLobbyMsgToAllSessions(GetSender(), packet, SessionData::Game | SessionData::Spectating | SessionData::SpectatorWaiting);
+	QueueLobbyNotification(packet);
 }
 
 void
@@ -487,8 +496,7 @@ ServerLobbyThread::NotifySpectatorLeftGame(unsigned gameId, unsigned playerId)
 	netListMsg->set_gameid(gameId);
 	netListMsg->set_playerid(playerId);
 
-	m_sessionManager.SendLobbyMsgToAllSessions(GetSender(), packet, SessionData::Established);
-	m_gameSessionManager.SendLobbyMsgToAllSessions(GetSender(), packet, SessionData::Game | SessionData::Spectating | SessionData::SpectatorWaiting);
+	QueueLobbyNotification(packet);
 }
 
 void
@@ -502,24 +510,60 @@ ServerLobbyThread::NotifyGameAdminChanged(unsigned gameId, unsigned newAdminPlay
 	netListMsg->set_gameid(gameId);
 	netListMsg->set_newadminplayerid(newAdminPlayerId);
 
-	m_sessionManager.SendLobbyMsgToAllSessions(GetSender(), packet, SessionData::Established);
-	m_gameSessionManager.SendLobbyMsgToAllSessions(GetSender(), packet, SessionData::Game | SessionData::Spectating | SessionData::SpectatorWaiting);
+	QueueLobbyNotification(packet);
 }
 
 void
 ServerLobbyThread::NotifyStartingGame(unsigned gameId)
 {
 	boost::shared_ptr<NetPacket> packet = CreateNetPacketGameListUpdate(gameId, GAME_MODE_STARTED);
-	m_sessionManager.SendLobbyMsgToAllSessions(GetSender(), packet, SessionData::Established);
-	m_gameSessionManager.SendLobbyMsgToAllSessions(GetSender(), packet, SessionData::Game | SessionData::Spectating | SessionData::SpectatorWaiting);
+	QueueLobbyNotification(packet);
 }
 
 void
 ServerLobbyThread::NotifyReopeningGame(unsigned gameId)
 {
 	boost::shared_ptr<NetPacket> packet = CreateNetPacketGameListUpdate(gameId, GAME_MODE_CREATED);
-	m_sessionManager.SendLobbyMsgToAllSessions(GetSender(), packet, SessionData::Established);
-	m_gameSessionManager.SendLobbyMsgToAllSessions(GetSender(), packet, SessionData::Game | SessionData::Spectating | SessionData::SpectatorWaiting);
+	QueueLobbyNotification(packet);
+}
+
+void
+ServerLobbyThread::QueueLobbyNotification(boost::shared_ptr<NetPacket> packet)
+{
+	if (!m_lobbyNotifyIntervalMsec) {
+		m_sessionManager.SendLobbyMsgToAllSessions(GetSender(), packet, SessionData::Established);
+		m_gameSessionManager.SendLobbyMsgToAllSessions(GetSender(), packet, SessionData::Game | SessionData::Spectating | SessionData::SpectatorWaiting);
+		return;
+	}
+	// Collect notifications and send them together after the flush interval.
+	if (m_lobbyNotifyList.empty()) {
+		m_lobbyNotifyTimer.expires_from_now(
+			boost::posix_time::milliseconds(m_lobbyNotifyIntervalMsec));
+		m_lobbyNotifyTimer.async_wait(
+			boost::bind(
+				&ServerLobbyThread::TimerFlushLobbyNotifications, shared_from_this(), boost::asio::placeholders::error));
+	}
+	m_lobbyNotifyList.push_back(packet);
+}
+
+void
+ServerLobbyThread::FlushLobbyNotifications()
+{
+	if (!m_lobbyNotifyList.empty()) {
+		NetPacketList tmpList;
+		tmpList.swap(m_lobbyNotifyList);
+		m_lobbyNotifyTimer.cancel();
+		m_sessionManager.SendLobbyMsgToAllSessions(GetSender(), tmpList, SessionData::Established);
+		m_gameSessionManager.SendLobbyMsgToAllSessions(GetSender(), tmpList, SessionData::Game | SessionData::Spectating | SessionData::SpectatorWaiting);
+	}
+}
+
+void
+ServerLobbyThread::TimerFlushLobbyNotifications(const boost::system::error_code &ec)
+{
+	if (!ec) {
+		FlushLobbyNotifications();
+	}
 }
 
 void
@@ -744,8 +788,16 @@ ServerLobbyThread::GetChatCleaner()
 ServerStats
 ServerLobbyThread::GetStats() const
 {
-	boost::mutex::scoped_lock lock(m_statMutex);
-	return m_statData;
+	ServerStats tmpStats;
+	{
+		boost::mutex::scoped_lock lock(m_statMutex);
+		tmpStats = m_statData;
+	}
+	SendStats tmpSendStats(m_sender->GetStats());
+	tmpStats.numberOfDroppedPackets = tmpSendStats.numDroppedPackets;
+	tmpStats.numberOfEvictedSessions = tmpSendStats.numEvictedSessions;
+	tmpStats.compressionSavedKBytes = static_cast<unsigned>(tmpSendStats.numCompressionSavedBytes / 1024);
+	return tmpStats;
 }
 
 boost::posix_time::ptime
@@ -760,6 +812,18 @@ ServerLobbyThread::GetServerMode() const
 	return m_mode;
 }
 
+bool
+ServerLobbyThread::IsFastForwardEnabled() const
+{
+	return m_fastForwardGames;
+}
+
+unsigned
+ServerLobbyThread::GetSpectatorDelaySec() const
+{
+	return m_spectatorDelaySec;
+}
+
 SenderHelper &
 ServerLobbyThread::GetSender()
 {
@@ -780,6 +844,20 @@ ServerLobbyThread::GetDatabase()
 	return m_database;
 }
 
+SessionTimerWheel &
+ServerLobbyThread::GetSessionTimers()
+{
+	assert(m_sessionTimers);
+	return *m_sessionTimers;
+}
+
+boost::shared_ptr<GameTimerWheel>
+ServerLobbyThread::GetGameTimers()
+{
+	assert(m_gameTimers);
+	return m_gameTimers;
+}
+
 ServerBanManager &
 ServerLobbyThread::GetBanManager()
 {
@@ -787,6 +865,13 @@ ServerLobbyThread::GetBanManager()
 	return *m_banManager;
 }
 
+bool
+ServerLobbyThread::IsConnectionAllowed(const boost::asio::ip::address &ipAddress)
+{
+	return !GetBanManager().IsIPAddressBanned(ipAddress)
+		   && (!m_connectLimiter || m_connectLimiter->IsConnectAllowed(ipAddress));
+}
+
 SessionDataCallback &
 ServerLobbyThread::GetSessionDataCallback()
 {
@@ -846,6 +931,7 @@ ServerLobbyThread::Main()
 		tmpGame.second->Exit();
 	}
 	m_gameMap.clear();
+	m_gameNames.clear();
 	// Cancel pending timer callbacks.
 	CancelTimers();
 	// Stop database engine.
@@ -875,6 +961,8 @@ ServerLobbyThread::RegisterTimers()
 	m_loginLockTimer.async_wait(
 		boost::bind(
 			&ServerLobbyThread::TimerUpdateClientLoginLock, shared_from_this(), boost::asio::placeholders::error));
+	// Handle session timeouts.
+	m_sessionTimers->Start();
 }
 
 void
@@ -883,6 +971,9 @@ ServerLobbyThread::CancelTimers()
 	m_removeGameTimer.cancel();
 	m_saveStatisticsTimer.cancel();
 	m_loginLockTimer.cancel();
+	m_lobbyNotifyTimer.cancel();
+	m_sessionTimers->Stop();
+	m_gameTimers->Stop();
 }
 
 void
@@ -937,12 +1028,22 @@ ServerLobbyThread::DispatchPacket(boost::shared_ptr<SessionData> session, boost:
 	}
 }
 
+void
+ServerLobbyThread::DispatchPacketBatch(boost::shared_ptr<SessionData> session, const NetPacketList &packetList)
+{
+	// Collect all replies and flush them when the batch is complete.
+	SenderBatch batch(GetSender());
+	BOOST_FOREACH(boost::shared_ptr<NetPacket> packet, packetList) {
+		DispatchPacket(session, packet);
+	}
+}
+
 void
 ServerLobbyThread::HandlePacket(boost::shared_ptr<SessionData> session, boost::shared_ptr<NetPacket> packet)
 {
 	if (session && packet) {
 		if (packet->IsClientActivity())
-			session->ResetActivityTimer();
+			m_sessionTimers->ResetActivityTimeout(session->GetId());
 
 		if (session->GetState() == SessionData::Init) {
 			if (packet->GetMsg()->messagetype() == PokerTHMessage::Type_InitMessage) {
@@ -1031,6 +1132,9 @@ ServerLobbyThread::HandleNetPacketInit(boost::shared_ptr<SessionData> session, c
 		SessionError(session, ERR_NET_VERSION_NOT_SUPPORTED);
 		return;
 	}
+	session->SetProtocolMinorVersion(initMessage.requestedversion().minorversion());
+	session->SetCompressionEnabled(initMessage.supportscompression());
+	session->SetFastForwardAccepted(initMessage.acceptsfastforward());
 #ifndef POKERTH_OFFICIAL_SERVER
 	// Check (clear text) server password (skip for official server, they are open to everyone).
 	string serverPassword;
@@ -1280,12 +1384,15 @@ ServerLobbyThread::HandleNetPacketRetrieveAvatar(boost::shared_ptr<SessionData>
 {
 	bool avatarFound = false;
 
-	string tmpFile;
 	MD5Buf tmpMD5;
 	memcpy(tmpMD5.GetData(), retrieveAvatar.avatarhash().data(), MD5_DATA_SIZE);
-	if (GetAvatarManager().GetAvatarFileName(tmpMD5, tmpFile)) {
+	if (GetAvatarManager().HasAvatar(tmpMD5)) {
 		NetPacketList tmpPackets;
-		if (GetAvatarManager().AvatarFileToNetPackets(tmpFile, retrieveAvatar.requestid(), tmpPackets) == 0) {
+		// Newer clients accept avatars in a few large chunks.
+		unsigned chunkSize = MAX_FILE_DATA_SIZE;
+		if (session->GetProtocolMinorVersion() >= NET_VERSION_MINOR_LARGE_AVATAR_CHUNKS)
+			chunkSize = MAX_AVATAR_CHUNK_SIZE;
+		if (GetAvatarManager().AvatarToNetPackets(tmpMD5, retrieveAvatar.requestid(), tmpPackets, chunkSize) == 0) {
 			avatarFound = true;
 			GetSender().Send(session, tmpPackets);
 		} else
@@ -1721,10 +1828,10 @@ ServerLobbyThread::EstablishSession(boost::shared_ptr<SessionData> session)
 	}
 	GetSender().Send(session, ack);
 
-	// Send the connected players list to the client.
-	SendPlayerList(session);
-	// Send the game list to the client.
-	SendGameList(session);
+	// Send the connected players and the game list to the client.
+	// Pending notifications are already part of the lobby state.
+	FlushLobbyNotifications();
+	SendLobbyState(session);
 
 	// Session is now established.
 	session->SetState(SessionData::Established);
@@ -1888,18 +1995,7 @@ ServerLobbyThread::TimerUpdateClientLoginLock(const boost::system::error_code &e
 bool
 ServerLobbyThread::IsGameNameInUse(const std::string &gameName) const
 {
-	bool found = false;
-	GameMap::const_iterator i = m_gameMap.begin();
-	GameMap::const_iterator end = m_gameMap.end();
-
-	while (i != end) {
-		if ((*i).second->GetName() == gameName) {
-			found = true;
-			break;
-		}
-		++i;
-	}
-	return found;
+	return m_gameNames.find(gameName) != m_gameNames.end();
 }
 
 boost::shared_ptr<ServerGame>
@@ -1920,9 +2016,11 @@ ServerLobbyThread::InternalAddGame(boost::shared_ptr<ServerGame> game)
 {
 	// Add game to list.
 	m_gameMap.insert(GameMap::value_type(game->GetId(), game));
+	m_gameNames.insert(game->GetName());
 	// Notify all players.
-	m_sessionManager.SendLobbyMsgToAllSessions(GetSender(), CreateNetPacketGameListNew(*game), SessionData::Established);
-	m_gameSessionManager.SendLobbyMsgToAllSessions(GetSender(), CreateNetPacketGameListNew(*game), SessionData::Game | SessionData::Spectating | SessionData::SpectatorWaiting);
+	QueueLobbyNotification(GetGameListNewPacket(*game));
+	// The creator is joined right away and needs the game info.
+	FlushLobbyNotifications();
 
 	{
 		boost::mutex::scoped_lock lock(m_statMutex);
@@ -1946,15 +2044,17 @@ ServerLobbyThread::InternalRemoveGame(boost::shared_ptr<ServerGame> game)
 		}
 	}
 	// Remove game from list.
-	m_gameMap.erase(game->GetId());
+	if (m_gameMap.erase(game->GetId())) {
+		GameNameSet::iterator pos = m_gameNames.find(game->GetName());
+		if (pos != m_gameNames.end())
+			m_gameNames.erase(pos);
+	}
 	// Remove all sessions left in the game.
 	game->ResetComputerPlayerList();
 	game->RemoveAllSessions();
 	game->Exit();
 	// Notify all players.
-	boost::shared_ptr<NetPacket> packet = CreateNetPacketGameListUpdate(game->GetId(), GAME_MODE_CLOSED);
-	m_sessionManager.SendLobbyMsgToAllSessions(GetSender(), packet, SessionData::Established);
-	m_gameSessionManager.SendLobbyMsgToAllSessions(GetSender(), packet, SessionData::Game | SessionData::Spectating | SessionData::SpectatorWaiting);
+	QueueLobbyNotification(CreateNetPacketGameListUpdate(game->GetId(), GAME_MODE_CLOSED));
 }
 
 void
@@ -1991,9 +2091,10 @@ void
 ServerLobbyThread::InternalResubscribeMsg(boost::shared_ptr<SessionData> session)
 {
 	if (!session->WantsLobbyMsg()) {
+		// Pending notifications are already part of the lobby state.
+		FlushLobbyNotifications();
 		session->SetWantsLobbyMsg();
-		SendPlayerList(session);
-		SendGameList(session);
+		SendLobbyState(session);
 		// Send new statistics information.
 		/*		boost::shared_ptr<NetPacket> packet(new NetPacket(NetPacket::Alloc));
 				packet->GetMsg()->present = PokerTHMessage_PR_statisticsMessage;
@@ -2117,12 +2218,73 @@ ServerLobbyThread::SendJoinGameFailed(boost::shared_ptr<SessionData> s, unsigned
 }
 
 void
-ServerLobbyThread::SendPlayerList(boost::shared_ptr<SessionData> s)
+ServerLobbyThread::SendLobbyState(boost::shared_ptr<SessionData> s)
+{
+	// Newer clients receive the full lobby state in a few packets,
+	// all later changes are sent as single notifications.
+	if (s->GetProtocolMinorVersion() >= NET_VERSION_MINOR_LOBBY_SNAPSHOT) {
+		SendLobbySnapshot(s);
+	} else {
+		SendPlayerList(s);
+		SendGameList(s);
+	}
+}
+
+void
+ServerLobbyThread::SendLobbySnapshot(boost::shared_ptr<SessionData> s)
+{
+	// Fill snapshot packets up to the maximum packet size.
+	NetPacketList packetList;
+	boost::shared_ptr<NetPacket> packet(CreateNetPacketLobbySnapshot());
+	bool packetEmpty = true;
+
+	PlayerIdList idList(GetLobbyPlayerIdList());
+	PlayerIdList::const_iterator i = idList.begin();
+	PlayerIdList::const_iterator end = idList.end();
+	while (i != end) {
+		packet->GetMsg()->mutable_lobbysnapshotmessage()->add_playerids(*i);
+		if (!packetEmpty && packet->GetMsg()->ByteSize() > MAX_PACKET_SIZE) {
+			packet->GetMsg()->mutable_lobbysnapshotmessage()->mutable_playerids()->RemoveLast();
+			packetList.push_back(packet);
+			packet = CreateNetPacketLobbySnapshot();
+			packet->GetMsg()->mutable_lobbysnapshotmessage()->add_playerids(*i);
+		}
+		packetEmpty = false;
+		++i;
+	}
+
+	GameMap::const_iterator game_i = m_gameMap.begin();
+	GameMap::const_iterator game_end = m_gameMap.end();
+	while (game_i != game_end) {
+		const GameListNewMessage &netGameList = GetGameListNewPacket(*game_i->second)->GetMsg()->gamelistnewmessage();
+		packet->GetMsg()->mutable_lobbysnapshotmessage()->add_games()->CopyFrom(netGameList);
+		if (!packetEmpty && packet->GetMsg()->ByteSize() > MAX_PACKET_SIZE) {
+			packet->GetMsg()->mutable_lobbysnapshotmessage()->mutable_games()->RemoveLast();
+			packetList.push_back(packet);
+			packet = CreateNetPacketLobbySnapshot();
+			packet->GetMsg()->mutable_lobbysnapshotmessage()->add_games()->CopyFrom(netGameList);
+		}
+		packetEmpty = false;
+		++game_i;
+	}
+	packetList.push_back(packet);
+	GetSender().Send(s, packetList);
+}
+
+PlayerIdList
+ServerLobbyThread::GetLobbyPlayerIdList() const
 {
 	// Retrieve all player ids.
 	PlayerIdList idList(m_sessionManager.GetPlayerIdList(SessionData::Established));
 	PlayerIdList gameIdList(m_gameSessionManager.GetPlayerIdList(SessionData::Game | SessionData::Spectating | SessionData::SpectatorWaiting));
 	idList.splice(idList.begin(), gameIdList);
+	return idList;
+}
+
+void
+ServerLobbyThread::SendPlayerList(boost::shared_ptr<SessionData> s)
+{
+	PlayerIdList idList(GetLobbyPlayerIdList());
 	// Send all player ids to client.
 	PlayerIdList::const_iterator i = idList.begin();
 	PlayerIdList::const_iterator end = idList.end();
@@ -2138,7 +2300,7 @@ ServerLobbyThread::SendGameList(boost::shared_ptr<SessionData> s)
 	GameMap::const_iterator game_i = m_gameMap.begin();
 	GameMap::const_iterator game_end = m_gameMap.end();
 	while (game_i != game_end) {
-		GetSender().Send(s, CreateNetPacketGameListNew(*game_i->second));
+		GetSender().Send(s, GetGameListNewPacket(*game_i->second));
 		++game_i;
 	}
 }
@@ -2300,19 +2462,43 @@ ServerLobbyThread::CreateNetPacketGameListNew(const ServerGame &game)
 {
 	boost::shared_ptr<NetPacket> packet(new NetPacket);
 	packet->GetMsg()->set_messagetype(PokerTHMessage::Type_GameListNewMessage);
-	GameListNewMessage *netGameList = packet->GetMsg()->mutable_gamelistnewmessage();
-	netGameList->set_gameid(game.GetId());
-	netGameList->set_adminplayerid(game.GetAdminPlayerId());
-	netGameList->set_gamemode(game.IsRunning() ? netGameStarted : netGameCreated);
-	NetPacket::SetGameData(game.GetGameData(), *netGameList->mutable_gameinfo());
-	netGameList->mutable_gameinfo()->set_gamename(game.GetName());
-	netGameList->set_isprivate(game.IsPasswordProtected());
+	SetGameListNewData(game, *packet->GetMsg()->mutable_gamelistnewmessage());
+	return packet;
+}
+
+boost::shared_ptr<NetPacket>
+ServerLobbyThread::GetGameListNewPacket(ServerGame &game)
+{
+	// Cached packets are never modified, they are replaced after changes.
+	if (!game.m_gameListPacket)
+		game.m_gameListPacket = CreateNetPacketGameListNew(game);
+	return game.m_gameListPacket;
+}
+
+boost::shared_ptr<NetPacket>
+ServerLobbyThread::CreateNetPacketLobbySnapshot()
+{
+	boost::shared_ptr<NetPacket> packet(new NetPacket);
+	packet->GetMsg()->set_messagetype(PokerTHMessage::Type_LobbySnapshotMessage);
+	packet->GetMsg()->mutable_lobbysnapshotmessage();
+	return packet;
+}
+
+void
+ServerLobbyThread::SetGameListNewData(const ServerGame &game, GameListNewMessage &netGameList)
+{
+	netGameList.set_gameid(game.GetId());
+	netGameList.set_adminplayerid(game.GetAdminPlayerId());
+	netGameList.set_gamemode(game.IsRunning() ? netGameStarted : netGameCreated);
+	NetPacket::SetGameData(game.GetGameData(), *netGameList.mutable_gameinfo());
+	netGameList.mutable_gameinfo()->set_gamename(game.GetName());
+	netGameList.set_isprivate(game.IsPasswordProtected());
 
 	PlayerIdList tmpList = game.GetPlayerIdList();
 	PlayerIdList::const_iterator i = tmpList.begin();
 	PlayerIdList::const_iterator end = tmpList.end();
 	while (i != end) {
-		netGameList->add_playerids(*i);
+		netGameList.add_playerids(*i);
 		++i;
 	}
 
@@ -2320,11 +2506,9 @@ ServerLobbyThread::CreateNetPacketGameListNew(const ServerGame &game)
 	i = tmpList.begin();
 	end = tmpList.end();
 	while (i != end) {
-		netGameList->add_spectatorids(*i);
+		netGameList.add_spectatorids(*i);
 		++i;
 	}
-
-	return packet;
 }
 
 boost::shared_ptr<NetPacket>
@@ -41,19 +41,17 @@
 using namespace std;
 using boost::asio::ip::tcp;
 
-SessionData::SessionData(boost::shared_ptr<boost::asio::ip::tcp::socket> sock, SessionId id, SessionDataCallback &cb, boost::asio::io_service &ioService)
-	: m_socket(sock), m_id(id), m_state(SessionData::Init), m_readyFlag(false), m_wantsLobbyMsg(true),
-	  m_activityTimeoutSec(0), m_activityWarningRemainingSec(0), m_initTimeoutTimer(ioService), m_globalTimeoutTimer(ioService),
-	  m_activityTimeoutTimer(ioService), m_callback(cb), m_authSession(NULL), m_curAuthStep(0)
+SessionData::SessionData(boost::shared_ptr<boost::asio::ip::tcp::socket> sock, SessionId id, SessionDataCallback &cb, size_t maxRecvPacketSize)
+	: m_socket(sock), m_id(id), m_state(SessionData::Init), m_readyFlag(false), m_wantsLobbyMsg(true), m_protocolMinorVersion(0), m_compressionEnabled(false), m_fastForwardAccepted(false),
+	  m_callback(cb), m_authSession(NULL), m_curAuthStep(0)
 {
-	m_receiveBuffer.reset(new AsioReceiveBuffer);
+	m_receiveBuffer.reset(new AsioReceiveBuffer(maxRecvPacketSize));
 	m_sendBuffer.reset(new AsioSendBuffer);
 }
 
-SessionData::SessionData(boost::shared_ptr<WebSocketData> webData, SessionId id, SessionDataCallback &cb, boost::asio::io_service &ioService, int /*filler*/)
-	: m_webData(webData), m_id(id), m_state(SessionData::Init), m_readyFlag(false), m_wantsLobbyMsg(true),
-	  m_activityTimeoutSec(0), m_activityWarningRemainingSec(0), m_initTimeoutTimer(ioService), m_globalTimeoutTimer(ioService),
-	  m_activityTimeoutTimer(ioService), m_callback(cb), m_authSession(NULL), m_curAuthStep(0)
+SessionData::SessionData(boost::shared_ptr<WebSocketData> webData, SessionId id, SessionDataCallback &cb, int /*filler*/)
+	: m_webData(webData), m_id(id), m_state(SessionData::Init), m_readyFlag(false), m_wantsLobbyMsg(true), m_protocolMinorVersion(0), m_compressionEnabled(false), m_fastForwardAccepted(false),
+	  m_callback(cb), m_authSession(NULL), m_curAuthStep(0)
 {
 	m_receiveBuffer.reset(new WebReceiveBuffer);
 	m_sendBuffer.reset(new WebSendBuffer);
@@ -211,38 +209,6 @@ SessionData::InternalClearAuthSession()
 	}
 }
 
-void
-SessionData::TimerInitTimeout(const boost::system::error_code &ec)
-{
-	if (!ec) {
-		if (GetState() == SessionData::Init) {
-			m_callback.SessionError(shared_from_this(), ERR_NET_SESSION_TIMED_OUT);
-		}
-	}
-}
-
-void
-SessionData::TimerSessionTimeout(const boost::system::error_code &ec)
-{
-	if (!ec) {
-		m_callback.SessionError(shared_from_this(), ERR_NET_SESSION_TIMED_OUT);
-	}
-}
-
-void
-SessionData::TimerActivityWarning(const boost::system::error_code &ec)
-{
-	if (!ec) {
-		m_callback.SessionTimeoutWarning(shared_from_this(), m_activityWarningRemainingSec);
-
-		m_activityTimeoutTimer.expires_from_now(
-			boost::posix_time::seconds(m_activityWarningRemainingSec));
-		m_activityTimeoutTimer.async_wait(
-			boost::bind(
-				&SessionData::TimerSessionTimeout, shared_from_this(), boost::asio::placeholders::error));
-	}
-}
-
 void
 SessionData::SetReadyFlag()
 {
@@ -285,92 +251,78 @@ SessionData::WantsLobbyMsg() const
 	return m_wantsLobbyMsg;
 }
 
-const std::string &
-SessionData::GetClientAddr() const
+void
+SessionData::SetProtocolMinorVersion(unsigned minorVersion)
 {
 	boost::mutex::scoped_lock lock(m_dataMutex);
-	return m_clientAddr;
+	m_protocolMinorVersion = minorVersion;
 }
 
-void
-SessionData::SetClientAddr(const std::string &addr)
+unsigned
+SessionData::GetProtocolMinorVersion() const
 {
 	boost::mutex::scoped_lock lock(m_dataMutex);
-	m_clientAddr = addr;
+	return m_protocolMinorVersion;
 }
 
 void
-SessionData::CloseSocketHandle()
+SessionData::SetCompressionEnabled(bool enabled)
 {
-	if (m_socket) {
-		boost::system::error_code ec;
-		m_socket->close(ec);
-	}
+	boost::mutex::scoped_lock lock(m_dataMutex);
+	m_compressionEnabled = enabled;
 }
 
-void
-SessionData::CloseWebSocketHandle()
+bool
+SessionData::IsCompressionEnabled() const
 {
-	if (m_webData) {
-		boost::system::error_code ec;
-		m_webData->webSocketServer->close(m_webData->webHandle, websocketpp::close::status::normal, "PokerTH server closed the connection.", ec);
-	}
+	boost::mutex::scoped_lock lock(m_dataMutex);
+	return m_compressionEnabled;
 }
 
 void
-SessionData::ResetActivityTimer()
+SessionData::SetFastForwardAccepted(bool accepted)
 {
 	boost::mutex::scoped_lock lock(m_dataMutex);
-	m_activityTimeoutTimer.expires_from_now(
-		boost::posix_time::seconds(m_activityTimeoutSec - m_activityWarningRemainingSec));
-	m_activityTimeoutTimer.async_wait(
-		boost::bind(
-			&SessionData::TimerActivityWarning, shared_from_this(), boost::asio::placeholders::error));
+	m_fastForwardAccepted = accepted;
 }
 
-void
-SessionData::StartTimerInitTimeout(unsigned timeoutSec)
+bool
+SessionData::IsFastForwardAccepted() const
 {
 	boost::mutex::scoped_lock lock(m_dataMutex);
-	m_initTimeoutTimer.expires_from_now(
-		boost::posix_time::seconds(timeoutSec));
-	m_initTimeoutTimer.async_wait(
-		boost::bind(
-			&SessionData::TimerInitTimeout, shared_from_this(), boost::asio::placeholders::error));
+	return m_fastForwardAccepted;
 }
 
-void
-SessionData::StartTimerGlobalTimeout(unsigned timeoutSec)
+const std::string &
+SessionData::GetClientAddr() const
 {
 	boost::mutex::scoped_lock lock(m_dataMutex);
-	m_globalTimeoutTimer.expires_from_now(
-		boost::posix_time::seconds(timeoutSec));
-	m_globalTimeoutTimer.async_wait(
-		boost::bind(
-			&SessionData::TimerSessionTimeout, shared_from_this(), boost::asio::placeholders::error));
+	return m_clientAddr;
 }
 
 void
-SessionData::StartTimerActivityTimeout(unsigned timeoutSec, unsigned warningRemainingSec)
+SessionData::SetClientAddr(const std::string &addr)
 {
 	boost::mutex::scoped_lock lock(m_dataMutex);
-	m_activityTimeoutSec = timeoutSec;
-	m_activityWarningRemainingSec = warningRemainingSec;
+	m_clientAddr = addr;
+}
 
-	m_activityTimeoutTimer.expires_from_now(
-		boost::posix_time::seconds(timeoutSec - warningRemainingSec));
-	m_activityTimeoutTimer.async_wait(
-		boost::bind(
-			&SessionData::TimerActivityWarning, shared_from_this(), boost::asio::placeholders::error));
+void
+SessionData::CloseSocketHandle()
+{
+	if (m_socket) {
+		boost::system::error_code ec;
+		m_socket->close(ec);
+	}
 }
 
 void
-SessionData::CancelTimers()
+SessionData::CloseWebSocketHandle()
 {
-	boost::mutex::scoped_lock lock(m_dataMutex);
-	m_initTimeoutTimer.cancel();
-	m_globalTimeoutTimer.cancel();
-	m_activityTimeoutTimer.cancel();
+	if (m_webData) {
+		boost::system::error_code ec;
+		m_webData->webSocketServer->close(m_webData->webHandle, websocketpp::close::status::normal, "PokerTH server closed the connection.", ec);
+	}
 }
 
 void
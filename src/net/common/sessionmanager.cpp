@@ -34,6 +34,8 @@
 #include <net/serverexception.h>
 #include <net/socket_msg.h>
 
+#include <boost/algorithm/string/case_conv.hpp>
+
 using namespace std;
 
 
@@ -49,7 +51,7 @@ SessionManager::~SessionManager()
 void
 SessionManager::AddSession(boost::shared_ptr<SessionData> session)
 {
-	boost::recursive_mutex::scoped_lock lock(m_sessionMapMutex);
+	boost::mutex::scoped_lock lock(m_sessionMapMutex);
 
 	SessionMap::iterator pos = m_sessionMap.lower_bound(session->GetId());
 
@@ -59,30 +61,59 @@ SessionManager::AddSession(boost::shared_ptr<SessionData> session)
 		throw ServerException(__FILE__, __LINE__, ERR_SOCK_CONN_EXISTS, 0);
 	}
 	m_sessionMap.insert(pos, SessionMap::value_type(session->GetId(), session));
+	m_sessionSnapshot.reset();
+	InternalAddPlayerIndex(session->GetId(), session->GetPlayerData());
+	InternalAddClientAddrIndex(session->GetId(), session->GetClientAddr());
 }
 
 void
 SessionManager::SetSessionPlayerData(SessionId session, boost::shared_ptr<PlayerData> playerData)
 {
-	boost::recursive_mutex::scoped_lock lock(m_sessionMapMutex);
+	boost::mutex::scoped_lock lock(m_sessionMapMutex);
 	SessionMap::iterator pos = m_sessionMap.find(session);
 
-	if (pos != m_sessionMap.end())
+	if (pos != m_sessionMap.end()) {
+		InternalRemovePlayerIndex(session, pos->second->GetPlayerData());
 		pos->second->SetPlayerData(playerData);
+		InternalAddPlayerIndex(session, playerData);
+	}
+}
+
+void
+SessionManager::SetSessionClientAddr(SessionId session, const std::string &clientAddr)
+{
+	boost::mutex::scoped_lock lock(m_sessionMapMutex);
+	SessionMap::iterator pos = m_sessionMap.find(session);
+
+	if (pos != m_sessionMap.end()) {
+		InternalRemoveClientAddrIndex(session, pos->second->GetClientAddr());
+		pos->second->SetClientAddr(clientAddr);
+		InternalAddClientAddrIndex(session, clientAddr);
+	}
 }
 
 bool
 SessionManager::RemoveSession(SessionId session)
 {
-	boost::recursive_mutex::scoped_lock lock(m_sessionMapMutex);
-	return m_sessionMap.erase(session) == 1;
+	bool retVal = false;
+	boost::mutex::scoped_lock lock(m_sessionMapMutex);
+	SessionMap::iterator pos = m_sessionMap.find(session);
+
+	if (pos != m_sessionMap.end()) {
+		InternalRemovePlayerIndex(session, pos->second->GetPlayerData());
+		InternalRemoveClientAddrIndex(session, pos->second->GetClientAddr());
+		m_sessionMap.erase(pos);
+		m_sessionSnapshot.reset();
+		retVal = true;
+	}
+	return retVal;
 }
 
 boost::shared_ptr<SessionData>
 SessionManager::GetSessionById(SessionId id) const
 {
 	boost::shared_ptr<SessionData> tmpSession;
-	boost::recursive_mutex::scoped_lock lock(m_sessionMapMutex);
+	boost::mutex::scoped_lock lock(m_sessionMapMutex);
 	SessionMap::const_iterator pos = m_sessionMap.find(id);
 	if (pos != m_sessionMap.end())
 		tmpSession = pos->second;
@@ -93,24 +124,25 @@ boost::shared_ptr<SessionData>
 SessionManager::GetSessionByPlayerName(const string &playerName) const
 {
 	boost::shared_ptr<SessionData> tmpSession;
-	boost::recursive_mutex::scoped_lock lock(m_sessionMapMutex);
+	boost::mutex::scoped_lock lock(m_sessionMapMutex);
 
-	SessionMap::const_iterator session_i = m_sessionMap.begin();
-	SessionMap::const_iterator session_end = m_sessionMap.end();
+	// The index is not case sensitive, the names still need to be compared.
+	pair<StringIndexMap::const_iterator, StringIndexMap::const_iterator> range =
+		m_playerNameMap.equal_range(boost::algorithm::to_lower_copy(playerName));
 
-	while (session_i != session_end) {
+	while (range.first != range.second) {
+		SessionMap::const_iterator pos = m_sessionMap.find(range.first->second);
 		// Check all players which are fully connected.
-		if (session_i->second->GetState() != SessionData::Init) {
-			boost::shared_ptr<PlayerData> tmpPlayer(session_i->second->GetPlayerData());
+		if (pos != m_sessionMap.end() && pos->second->GetState() != SessionData::Init) {
+			boost::shared_ptr<PlayerData> tmpPlayer(pos->second->GetPlayerData());
 			if (!tmpPlayer)
 				throw ServerException(__FILE__, __LINE__, ERR_NET_INVALID_SESSION, 0);
 			if (tmpPlayer->GetName() == playerName) {
-				tmpSession = session_i->second;
+				tmpSession = pos->second;
 				break;
 			}
 		}
-
-		++session_i;
+		++range.first;
 	}
 	return tmpSession;
 }
@@ -119,22 +151,16 @@ boost::shared_ptr<SessionData>
 SessionManager::GetSessionByUniquePlayerId(unsigned uniqueId, bool initSessions) const
 {
 	boost::shared_ptr<SessionData> tmpSession;
-	boost::recursive_mutex::scoped_lock lock(m_sessionMapMutex);
+	boost::mutex::scoped_lock lock(m_sessionMapMutex);
 
-	SessionMap::const_iterator session_i = m_sessionMap.begin();
-	SessionMap::const_iterator session_end = m_sessionMap.end();
-
-	while (session_i != session_end) {
+	PlayerIdMap::const_iterator id_pos = m_playerIdMap.find(uniqueId);
+	if (id_pos != m_playerIdMap.end()) {
+		SessionMap::const_iterator pos = m_sessionMap.find(id_pos->second);
 		// Check all players which are fully connected.
-		if (initSessions || session_i->second->GetState() != SessionData::Init) {
-			boost::shared_ptr<PlayerData> tmpPlayer(session_i->second->GetPlayerData());
-			if (tmpPlayer && tmpPlayer->GetUniqueId() == uniqueId) {
-				tmpSession = session_i->second;
-				break;
-			}
+		if (pos != m_sessionMap.end()
+				&& (initSessions || pos->second->GetState() != SessionData::Init)) {
+			tmpSession = pos->second;
 		}
-
-		++session_i;
 	}
 	return tmpSession;
 }
@@ -143,15 +169,15 @@ PlayerDataList
 SessionManager::GetPlayerDataList() const
 {
 	PlayerDataList playerList;
-	boost::recursive_mutex::scoped_lock lock(m_sessionMapMutex);
+	SessionListSnapshot tmpSessions(GetSnapshot());
 
-	SessionMap::const_iterator session_i = m_sessionMap.begin();
-	SessionMap::const_iterator session_end = m_sessionMap.end();
+	SessionList::const_iterator session_i = tmpSessions->begin();
+	SessionList::const_iterator session_end = tmpSessions->end();
 
 	while (session_i != session_end) {
 		// Get all players in the game.
-		if (session_i->second->GetState() == SessionData::Game) {
-			boost::shared_ptr<PlayerData> tmpPlayer(session_i->second->GetPlayerData());
+		if ((*session_i)->GetState() == SessionData::Game) {
+			boost::shared_ptr<PlayerData> tmpPlayer((*session_i)->GetPlayerData());
 			if (!tmpPlayer.get() || tmpPlayer->GetName().empty())
 				throw ServerException(__FILE__, __LINE__, ERR_NET_INVALID_SESSION, 0);
 			playerList.push_back(tmpPlayer);
@@ -165,15 +191,15 @@ PlayerDataList
 SessionManager::GetSpectatorDataList() const
 {
 	PlayerDataList spectatorList;
-	boost::recursive_mutex::scoped_lock lock(m_sessionMapMutex);
+	SessionListSnapshot tmpSessions(GetSnapshot());
 
-	SessionMap::const_iterator session_i = m_sessionMap.begin();
-	SessionMap::const_iterator session_end = m_sessionMap.end();
+	SessionList::const_iterator session_i = tmpSessions->begin();
+	SessionList::const_iterator session_end = tmpSessions->end();
 
 	while (session_i != session_end) {
 		// Get all spectators of the game.
-		if (session_i->second->GetState() == SessionData::Spectating || session_i->second->GetState() == SessionData::SpectatorWaiting) {
-			boost::shared_ptr<PlayerData> tmpPlayer(session_i->second->GetPlayerData());
+		if ((*session_i)->GetState() == SessionData::Spectating || (*session_i)->GetState() == SessionData::SpectatorWaiting) {
+			boost::shared_ptr<PlayerData> tmpPlayer((*session_i)->GetPlayerData());
 			if (!tmpPlayer.get() || tmpPlayer->GetName().empty())
 				throw ServerException(__FILE__, __LINE__, ERR_NET_INVALID_SESSION, 0);
 			spectatorList.push_back(tmpPlayer);
@@ -187,15 +213,15 @@ PlayerIdList
 SessionManager::GetPlayerIdList(int state) const
 {
 	PlayerIdList playerList;
-	boost::recursive_mutex::scoped_lock lock(m_sessionMapMutex);
+	SessionListSnapshot tmpSessions(GetSnapshot());
 
-	SessionMap::const_iterator session_i = m_sessionMap.begin();
-	SessionMap::const_iterator session_end = m_sessionMap.end();
+	SessionList::const_iterator session_i = tmpSessions->begin();
+	SessionList::const_iterator session_end = tmpSessions->end();
 
 	while (session_i != session_end) {
 		// Get all players in the game.
-		if ((session_i->second->GetState() & state) != 0) {
-			playerList.push_back(session_i->second->GetPlayerData()->GetUniqueId());
+		if (((*session_i)->GetState() & state) != 0) {
+			playerList.push_back((*session_i)->GetPlayerData()->GetUniqueId());
 		}
 		++session_i;
 	}
@@ -231,35 +257,22 @@ SessionManager::IsPlayerConnected(unsigned uniqueId) const
 bool
 SessionManager::IsClientAddressConnected(const std::string &clientAddress) const
 {
-	bool retVal = false;
-	boost::recursive_mutex::scoped_lock lock(m_sessionMapMutex);
-
-	SessionMap::const_iterator i = m_sessionMap.begin();
-	SessionMap::const_iterator end = m_sessionMap.end();
-
-	while (i != end) {
-		if ((*i).second->GetClientAddr() == clientAddress) {
-			retVal = true;
-			break;
-		}
-		++i;
-	}
-	return retVal;
+	boost::mutex::scoped_lock lock(m_sessionMapMutex);
+	return m_clientAddrMap.find(clientAddress) != m_clientAddrMap.end();
 }
 
 void
 SessionManager::ForEach(boost::function<void (boost::shared_ptr<SessionData>)> func)
 {
-	boost::recursive_mutex::scoped_lock lock(m_sessionMapMutex);
+	SessionListSnapshot tmpSessions(GetSnapshot());
 
-	SessionMap::iterator i = m_sessionMap.begin();
-	SessionMap::iterator end = m_sessionMap.end();
+	SessionList::const_iterator i = tmpSessions->begin();
+	SessionList::const_iterator end = tmpSessions->end();
 
+	// The callback is allowed to modify the session manager.
 	while (i != end) {
-		SessionMap::iterator next = i;
-		++next;
-		func((*i).second);
-		i = next;
+		func(*i);
+		++i;
 	}
 }
 
@@ -267,13 +280,13 @@ unsigned
 SessionManager::CountReadySessions() const
 {
 	unsigned counter = 0;
-	boost::recursive_mutex::scoped_lock lock(m_sessionMapMutex);
+	SessionListSnapshot tmpSessions(GetSnapshot());
 
-	SessionMap::const_iterator i = m_sessionMap.begin();
-	SessionMap::const_iterator end = m_sessionMap.end();
+	SessionList::const_iterator i = tmpSessions->begin();
+	SessionList::const_iterator end = tmpSessions->end();
 
 	while (i != end) {
-		if ((*i).second->IsReady())
+		if ((*i)->IsReady())
 			++counter;
 		++i;
 	}
@@ -283,13 +296,13 @@ SessionManager::CountReadySessions() const
 void
 SessionManager::ResetAllReadyFlags()
 {
-	boost::recursive_mutex::scoped_lock lock(m_sessionMapMutex);
+	SessionListSnapshot tmpSessions(GetSnapshot());
 
-	SessionMap::iterator i = m_sessionMap.begin();
-	SessionMap::iterator end = m_sessionMap.end();
+	SessionList::const_iterator i = tmpSessions->begin();
+	SessionList::const_iterator end = tmpSessions->end();
 
 	while (i != end) {
-		(*i).second->ResetReadyFlag();
+		(*i)->ResetReadyFlag();
 		++i;
 	}
 }
@@ -297,7 +310,7 @@ SessionManager::ResetAllReadyFlags()
 void
 SessionManager::Clear()
 {
-	boost::recursive_mutex::scoped_lock lock(m_sessionMapMutex);
+	boost::mutex::scoped_lock lock(m_sessionMapMutex);
 	SessionMap::iterator i = m_sessionMap.begin();
 	SessionMap::iterator end = m_sessionMap.end();
 
@@ -309,12 +322,16 @@ SessionManager::Clear()
 		++i;
 	}
 	m_sessionMap.clear();
+	m_sessionSnapshot.reset();
+	m_playerIdMap.clear();
+	m_playerNameMap.clear();
+	m_clientAddrMap.clear();
 }
 
 unsigned
 SessionManager::GetRawSessionCount() const
 {
-	boost::recursive_mutex::scoped_lock lock(m_sessionMapMutex);
+	boost::mutex::scoped_lock lock(m_sessionMapMutex);
 	return (unsigned)m_sessionMap.size();
 }
 
@@ -322,13 +339,13 @@ unsigned
 SessionManager::GetSessionCountWithState(int state) const
 {
 	unsigned counter = 0;
-	boost::recursive_mutex::scoped_lock lock(m_sessionMapMutex);
+	SessionListSnapshot tmpSessions(GetSnapshot());
 
-	SessionMap::const_iterator i = m_sessionMap.begin();
-	SessionMap::const_iterator end = m_sessionMap.end();
+	SessionList::const_iterator i = tmpSessions->begin();
+	SessionList::const_iterator end = tmpSessions->end();
 
 	while (i != end) {
-		if ((i->second->GetState() & state) != 0)
+		if (((*i)->GetState() & state) != 0)
 			++counter;
 		++i;
 	}
@@ -339,13 +356,13 @@ bool
 SessionManager::HasSessionWithState(int state) const
 {
 	bool retVal = false;
-	boost::recursive_mutex::scoped_lock lock(m_sessionMapMutex);
+	SessionListSnapshot tmpSessions(GetSnapshot());
 
-	SessionMap::const_iterator i = m_sessionMap.begin();
-	SessionMap::const_iterator end = m_sessionMap.end();
+	SessionList::const_iterator i = tmpSessions->begin();
+	SessionList::const_iterator end = tmpSessions->end();
 
 	while (i != end) {
-		if ((i->second->GetState() & state) != 0) {
+		if (((*i)->GetState() & state) != 0) {
 			retVal = true;
 			break;
 		}
@@ -354,21 +371,40 @@ SessionManager::HasSessionWithState(int state) const
 	return retVal;
 }
 
+bool
+SessionManager::IsFastForwardAcceptedByAll(int state) const
+{
+	bool retVal = true;
+	SessionListSnapshot tmpSessions(GetSnapshot());
+
+	SessionList::const_iterator i = tmpSessions->begin();
+	SessionList::const_iterator end = tmpSessions->end();
+
+	while (i != end) {
+		if (((*i)->GetState() & state) != 0 && !(*i)->IsFastForwardAccepted()) {
+			retVal = false;
+			break;
+		}
+		++i;
+	}
+	return retVal;
+}
+
 void
 SessionManager::SendToAllSessions(SenderHelper &sender, boost::shared_ptr<NetPacket> packet, int state)
 {
-	boost::recursive_mutex::scoped_lock lock(m_sessionMapMutex);
+	SessionListSnapshot tmpSessions(GetSnapshot());
 
-	SessionMap::iterator i = m_sessionMap.begin();
-	SessionMap::iterator end = m_sessionMap.end();
+	SessionList::const_iterator i = tmpSessions->begin();
+	SessionList::const_iterator end = tmpSessions->end();
 
 	while (i != end) {
-		if (!i->second.get())
+		if (!i->get())
 			throw ServerException(__FILE__, __LINE__, ERR_NET_INVALID_SESSION, 0);
 
 		// Send each client (with a certain state) a copy of the packet.
-		if ((i->second->GetState() & state) != 0)
-			sender.Send(i->second, packet);
+		if (((*i)->GetState() & state) != 0)
+			sender.Send(*i, packet);
 		++i;
 	}
 }
@@ -376,36 +412,123 @@ SessionManager::SendToAllSessions(SenderHelper &sender, boost::shared_ptr<NetPac
 void
 SessionManager::SendLobbyMsgToAllSessions(SenderHelper &sender, boost::shared_ptr<NetPacket> packet, int state)
 {
-	boost::recursive_mutex::scoped_lock lock(m_sessionMapMutex);
+	SessionListSnapshot tmpSessions(GetSnapshot());
 
-	SessionMap::iterator i = m_sessionMap.begin();
-	SessionMap::iterator end = m_sessionMap.end();
+	SessionList::const_iterator i = tmpSessions->begin();
+	SessionList::const_iterator end = tmpSessions->end();
 
 	while (i != end) {
-		if (!i->second.get())
+		if (!i->get())
 			throw ServerException(__FILE__, __LINE__, ERR_NET_INVALID_SESSION, 0);
 
 		// Send each client (with a certain state) a copy of the packet.
-		if ((i->second->GetState() & state) != 0 && i->second->WantsLobbyMsg())
-			sender.Send(i->second, packet);
+		if (((*i)->GetState() & state) != 0 && (*i)->WantsLobbyMsg())
+			sender.Send(*i, packet);
 		++i;
 	}
 }
 
+void
+SessionManager::SendLobbyMsgToAllSessions(SenderHelper &sender, const NetPacketList &packetList, int state)
+{
+	SessionListSnapshot tmpSessions(GetSnapshot());
+	SenderHelper::SessionList receivers;
+
+	SessionList::const_iterator i = tmpSessions->begin();
+	SessionList::const_iterator end = tmpSessions->end();
+
+	while (i != end) {
+		if (!i->get())
+			throw ServerException(__FILE__, __LINE__, ERR_NET_INVALID_SESSION, 0);
+
+		// Send each client (with a certain state) all packets at once.
+		if (((*i)->GetState() & state) != 0 && (*i)->WantsLobbyMsg())
+			receivers.push_back(*i);
+		++i;
+	}
+	// The packets are compressed only once for all receivers.
+	sender.Send(receivers, packetList);
+}
+
 void
 SessionManager::SendToAllButOneSessions(SenderHelper &sender, boost::shared_ptr<NetPacket> packet, SessionId except, int state)
 {
-	boost::recursive_mutex::scoped_lock lock(m_sessionMapMutex);
+	SessionListSnapshot tmpSessions(GetSnapshot());
 
-	SessionMap::iterator i = m_sessionMap.begin();
-	SessionMap::iterator end = m_sessionMap.end();
+	SessionList::const_iterator i = tmpSessions->begin();
+	SessionList::const_iterator end = tmpSessions->end();
 
 	while (i != end) {
 		// Send each fully connected client but one a copy of the packet.
-		if ((i->second->GetState() & state) != 0)
-			if (i->first != except)
-				sender.Send(i->second, packet);
+		if (((*i)->GetState() & state) != 0)
+			if ((*i)->GetId() != except)
+				sender.Send(*i, packet);
 		++i;
 	}
 }
 
+SessionManager::SessionListSnapshot
+SessionManager::GetSnapshot() const
+{
+	boost::mutex::scoped_lock lock(m_sessionMapMutex);
+	// Rebuild the snapshot only after the session map was modified.
+	if (!m_sessionSnapshot) {
+		boost::shared_ptr<SessionList> tmpList(new SessionList);
+		tmpList->reserve(m_sessionMap.size());
+		SessionMap::const_iterator i = m_sessionMap.begin();
+		SessionMap::const_iterator end = m_sessionMap.end();
+		while (i != end) {
+			tmpList->push_back(i->second);
+			++i;
+		}
+		m_sessionSnapshot = tmpList;
+	}
+	return m_sessionSnapshot;
+}
+
+void
+SessionManager::InternalAddPlayerIndex(SessionId session, boost::shared_ptr<PlayerData> playerData)
+{
+	if (playerData) {
+		m_playerIdMap[playerData->GetUniqueId()] = session;
+		m_playerNameMap.insert(StringIndexMap::value_type(boost::algorithm::to_lower_copy(playerData->GetName()), session));
+	}
+}
+
+void
+SessionManager::InternalRemovePlayerIndex(SessionId session, boost::shared_ptr<PlayerData> playerData)
+{
+	if (playerData) {
+		PlayerIdMap::iterator pos = m_playerIdMap.find(playerData->GetUniqueId());
+		if (pos != m_playerIdMap.end() && pos->second == session)
+			m_playerIdMap.erase(pos);
+		InternalEraseIndexEntry(m_playerNameMap, boost::algorithm::to_lower_copy(playerData->GetName()), session);
+	}
+}
+
+void
+SessionManager::InternalAddClientAddrIndex(SessionId session, const std::string &clientAddr)
+{
+	if (!clientAddr.empty())
+		m_clientAddrMap.insert(StringIndexMap::value_type(clientAddr, session));
+}
+
+void
+SessionManager::InternalRemoveClientAddrIndex(SessionId session, const std::string &clientAddr)
+{
+	if (!clientAddr.empty())
+		InternalEraseIndexEntry(m_clientAddrMap, clientAddr, session);
+}
+
+void
+SessionManager::InternalEraseIndexEntry(StringIndexMap &indexMap, const std::string &key, SessionId session)
+{
+	pair<StringIndexMap::iterator, StringIndexMap::iterator> range = indexMap.equal_range(key);
+	while (range.first != range.second) {
+		if (range.first->second == session) {
+			indexMap.erase(range.first);
+			break;
+		}
+		++range.first;
+	}
+}
@@ -0,0 +1,255 @@
+/*****************************************************************************
+ * PokerTH - The open source texas holdem engine                             *
+ * Copyright (C) 2006-2013 Felix Hammer, Florian Thauer, Lothar May          *
+ *                                                                           *
+ * This program is free software: you can redistribute it and/or modify      *
+ * it under the terms of the GNU Affero General Public License as            *
+ * published by the Free Software Foundation, either version 3 of the        *
+ * License, or (at your option) any later version.                           *
+ *                                                                           *
+ * This program is distributed in the hope that it will be useful,           *
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of            *
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the             *
+ * GNU Affero General Public License for more details.                       *
+ *                                                                           *
+ * You should have received a copy of the GNU Affero General Public License  *
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.     *
+ *                                                                           *
+ *                                                                           *
+ * Additional permission under GNU AGPL version 3 section 7                  *
+ *                                                                           *
+ * If you modify this program, or any covered work, by linking or            *
+ * combining it with the OpenSSL project's OpenSSL library (or a             *
+ * modified version of that library), containing parts covered by the        *
+ * terms of the OpenSSL or SSLeay licenses, the authors of PokerTH           *
+ * (Felix Hammer, Florian Thauer, Lothar May) grant you additional           *
+ * permission to convey the resulting work.                                  *
+ * Corresponding Source for a non-source form of such a combination          *
+ * shall include the source code for the parts of OpenSSL used as well       *
+ * as that of the covered work.                                              *
+ *****************************************************************************/
+
+#include <net/sessiontimerwheel.h>
+#include <net/socket_msg.h>
+
+#include <boost/bind.hpp>
+
+using namespace std;
+
+
+SessionTimerWheel::SessionTimerWheel(boost::shared_ptr<boost::asio::io_service> ioService, SessionDataCallback &callback)
+	: m_ioService(ioService), m_tickTimer(*ioService), m_callback(callback),
+	  m_wheel(SESSION_TIMER_NUM_SLOTS), m_curSlot(0)
+{
+}
+
+SessionTimerWheel::~SessionTimerWheel()
+{
+}
+
+void
+SessionTimerWheel::Start()
+{
+	m_tickTimer.expires_from_now(
+		boost::posix_time::milliseconds(SESSION_TIMER_TICK_MSEC));
+	m_tickTimer.async_wait(
+		boost::bind(
+			&SessionTimerWheel::TimerTick, shared_from_this(), boost::asio::placeholders::error));
+}
+
+void
+SessionTimerWheel::Stop()
+{
+	m_tickTimer.cancel();
+
+	boost::mutex::scoped_lock lock(m_wheelMutex);
+	m_sessionTimeouts.clear();
+	for (unsigned i = 0; i < SESSION_TIMER_NUM_SLOTS; i++) {
+		m_wheel[i].clear();
+	}
+}
+
+void
+SessionTimerWheel::StartInitTimeout(boost::shared_ptr<SessionData> session, unsigned timeoutSec)
+{
+	boost::mutex::scoped_lock lock(m_wheelMutex);
+	InternalSchedule(InternalGetSessionTimeouts(session), session->GetId(), TIMEOUT_INIT, timeoutSec);
+}
+
+void
+SessionTimerWheel::StartGlobalTimeout(boost::shared_ptr<SessionData> session, unsigned timeoutSec)
+{
+	boost::mutex::scoped_lock lock(m_wheelMutex);
+	InternalSchedule(InternalGetSessionTimeouts(session), session->GetId(), TIMEOUT_GLOBAL, timeoutSec);
+}
+
+void
+SessionTimerWheel::StartActivityTimeout(boost::shared_ptr<SessionData> session, unsigned timeoutSec, unsigned warningRemainingSec)
+{
+	boost::mutex::scoped_lock lock(m_wheelMutex);
+	SessionTimeouts &timeouts = InternalGetSessionTimeouts(session);
+	timeouts.activityTimeoutSec = timeoutSec;
+	timeouts.activityWarningRemainingSec = warningRemainingSec;
+	InternalSchedule(timeouts, session->GetId(), TIMEOUT_ACTIVITY_WARNING, timeoutSec - warningRemainingSec);
+}
+
+void
+SessionTimerWheel::ResetActivityTimeout(SessionId session)
+{
+	boost::mutex::scoped_lock lock(m_wheelMutex);
+	SessionTimeoutMap::iterator pos = m_sessionTimeouts.find(session);
+	if (pos != m_sessionTimeouts.end() && pos->second.activityTimeoutSec) {
+		SessionTimeouts &timeouts = pos->second;
+		InternalSchedule(timeouts, session, TIMEOUT_ACTIVITY_WARNING, timeouts.activityTimeoutSec - timeouts.activityWarningRemainingSec);
+	}
+}
+
+void
+SessionTimerWheel::CancelTimeouts(SessionId session)
+{
+	boost::mutex::scoped_lock lock(m_wheelMutex);
+	SessionTimeoutMap::iterator pos = m_sessionTimeouts.find(session);
+	if (pos != m_sessionTimeouts.end()) {
+		for (int i = 0; i < NUM_SLOT_TYPES; i++) {
+			InternalUnschedule(pos->second, static_cast<SlotType>(i));
+		}
+		m_sessionTimeouts.erase(pos);
+	}
+}
+
+SessionTimerWheel::SessionTimeouts &
+SessionTimerWheel::InternalGetSessionTimeouts(boost::shared_ptr<SessionData> session)
+{
+	SessionTimeouts &timeouts = m_sessionTimeouts[session->GetId()];
+	timeouts.session = session;
+	return timeouts;
+}
+
+void
+SessionTimerWheel::InternalSchedule(SessionTimeouts &timeouts, SessionId sessionId, TimeoutType type, unsigned timeoutSec)
+{
+	SlotType slotType = GetSlotType(type);
+	InternalUnschedule(timeouts, slotType);
+
+	// A timeout expires after at least one tick.
+	unsigned ticks = static_cast<unsigned>((static_cast<unsigned long long>(timeoutSec) * 1000 + SESSION_TIMER_TICK_MSEC - 1) / SESSION_TIMER_TICK_MSEC);
+	if (ticks == 0)
+		ticks = 1;
+	unsigned slot = (m_curSlot + ticks) % SESSION_TIMER_NUM_SLOTS;
+
+	WheelEntry entry;
+	entry.sessionId = sessionId;
+	entry.type = type;
+	entry.rounds = (ticks - 1) / SESSION_TIMER_NUM_SLOTS;
+
+	timeouts.active[slotType] = true;
+	timeouts.slot[slotType] = slot;
+	timeouts.pos[slotType] = m_wheel[slot].insert(m_wheel[slot].end(), entry);
+}
+
+void
+SessionTimerWheel::InternalUnschedule(SessionTimeouts &timeouts, SlotType slotType)
+{
+	if (timeouts.active[slotType]) {
+		m_wheel[timeouts.slot[slotType]].erase(timeouts.pos[slotType]);
+		timeouts.active[slotType] = false;
+	}
+}
+
+void
+SessionTimerWheel::InternalHandleExpired(const ExpiredTimeout &expired)
+{
+	boost::shared_ptr<SessionData> session = expired.session.lock();
+	if (session) {
+		switch (expired.type) {
+		case TIMEOUT_INIT :
+			if (session->GetState() == SessionData::Init) {
+				m_callback.SessionError(session, ERR_NET_SESSION_TIMED_OUT);
+			}
+			break;
+		case TIMEOUT_ACTIVITY_WARNING :
+			m_callback.SessionTimeoutWarning(session, expired.remainingSec);
+			break;
+		case TIMEOUT_GLOBAL :
+		case TIMEOUT_ACTIVITY :
+			m_callback.SessionError(session, ERR_NET_SESSION_TIMED_OUT);
+			break;
+		}
+	}
+}
+
+SessionTimerWheel::SlotType
+SessionTimerWheel::GetSlotType(TimeoutType type)
+{
+	SlotType retVal = SLOT_ACTIVITY;
+	if (type == TIMEOUT_INIT)
+		retVal = SLOT_INIT;
+	else if (type == TIMEOUT_GLOBAL)
+		retVal = SLOT_GLOBAL;
+	return retVal;
+}
+
+void
+SessionTimerWheel::TimerTick(const boost::system::error_code &ec)
+{
+	if (!ec) {
+		ExpiredList expiredList;
+		{
+			boost::mutex::scoped_lock lock(m_wheelMutex);
+			m_curSlot = (m_curSlot + 1) % SESSION_TIMER_NUM_SLOTS;
+			WheelSlot &curSlot = m_wheel[m_curSlot];
+
+			// Only process the entries which are already in this slot. Entries
+			// which are rescheduled to the current slot are added at the end.
+			size_t numEntries = curSlot.size();
+			WheelSlot::iterator i = curSlot.begin();
+			while (numEntries > 0) {
+				WheelSlot::iterator next = i;
+				++next;
+				if (i->rounds > 0) {
+					--i->rounds;
+				} else {
+					SessionTimeoutMap::iterator pos = m_sessionTimeouts.find(i->sessionId);
+					if (pos != m_sessionTimeouts.end()) {
+						SessionTimeouts &timeouts = pos->second;
+						ExpiredTimeout expired;
+						expired.session = timeouts.session;
+						expired.type = i->type;
+						expired.remainingSec = timeouts.activityWarningRemainingSec;
+						SessionId sessionId = i->sessionId;
+						// This also removes the entry from the current slot.
+						InternalUnschedule(timeouts, GetSlotType(expired.type));
+
+						if (timeouts.session.expired()) {
+							// Session is gone, forget it after the last timeout.
+							if (!timeouts.active[SLOT_INIT] && !timeouts.active[SLOT_GLOBAL] && !timeouts.active[SLOT_ACTIVITY])
+								m_sessionTimeouts.erase(pos);
+						} else {
+							if (expired.type == TIMEOUT_ACTIVITY_WARNING) {
+								// The session is closed if there is no activity after the warning.
+								InternalSchedule(timeouts, sessionId, TIMEOUT_ACTIVITY, timeouts.activityWarningRemainingSec);
+							}
+							expiredList.push_back(expired);
+						}
+					} else {
+						curSlot.erase(i);
+					}
+				}
+				i = next;
+				--numEntries;
+			}
+		}
+		// Handle the timeouts without holding the lock, the callbacks may cancel timeouts.
+		ExpiredList::const_iterator expired_i = expiredList.begin();
+		ExpiredList::const_iterator expired_end = expiredList.end();
+		while (expired_i != expired_end) {
+			InternalHandleExpired(*expired_i);
+			++expired_i;
+		}
+
+		m_tickTimer.expires_at(m_tickTimer.expires_at() + boost::posix_time::milliseconds(SESSION_TIMER_TICK_MSEC));
+		m_tickTimer.async_wait(
+			boost::bind(
+				&SessionTimerWheel::TimerTick, shared_from_this(), boost::asio::placeholders::error));
+	}
+}
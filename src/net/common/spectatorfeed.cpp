@@ -0,0 +1,158 @@
+/*****************************************************************************
+ * PokerTH - The open source texas holdem engine                             *
+ * Copyright (C) 2006-2013 Felix Hammer, Florian Thauer, Lothar May          *
+ *                                                                           *
+ * This program is free software: you can redistribute it and/or modify      *
+ * it under the terms of the GNU Affero General Public License as            *
+ * published by the Free Software Foundation, either version 3 of the        *
+ * License, or (at your option) any later version.                           *
+ *                                                                           *
+ * This program is distributed in the hope that it will be useful,           *
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of            *
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the             *
+ * GNU Affero General Public License for more details.                       *
+ *                                                                           *
+ * You should have received a copy of the GNU Affero General Public License  *
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.     *
+ *                                                                           *
+ *                                                                           *
+ * Additional permission under GNU AGPL version 3 section 7                  *
+ *                                                                           *
+ * If you modify this program, or any covered work, by linking or            *
+ * combining it with the OpenSSL project's OpenSSL library (or a             *
+ * modified version of that library), containing parts covered by the        *
+ * terms of the OpenSSL or SSLeay licenses, the authors of PokerTH           *
+ * (Felix Hammer, Florian Thauer, Lothar May) grant you additional           *
+ * permission to convey the resulting work.                                  *
+ * Corresponding Source for a non-source form of such a combination          *
+ * shall include the source code for the parts of OpenSSL used as well       *
+ * as that of the covered work.                                              *
+ *****************************************************************************/
+
+#include <net/spectatorfeed.h>
+#include <net/sessionmanager.h>
+#include <net/senderhelper.h>
+
+using namespace std;
+
+
+SpectatorFeed::SpectatorFeed(unsigned delaySec)
+	: m_delayMsec(delaySec * 1000)
+{
+}
+
+SpectatorFeed::~SpectatorFeed()
+{
+}
+
+unsigned
+SpectatorFeed::GetDelayMsec() const
+{
+	return m_delayMsec;
+}
+
+bool
+SpectatorFeed::Push(boost::shared_ptr<NetPacket> packet)
+{
+	// Nobody is watching, drop the packet.
+	if (m_spectators.empty() && m_entries.empty())
+		return false;
+
+	bool wasEmpty = m_entries.empty();
+	FeedEntry entry;
+	entry.dueMsec = m_clock.elapsed().total_milliseconds() + m_delayMsec;
+	entry.packet = packet;
+	entry.newSpectator = INVALID_SESSION;
+	m_entries.push_back(entry);
+	return wasEmpty;
+}
+
+bool
+SpectatorFeed::AddSpectator(SessionId session, boost::shared_ptr<NetPacket> initialPacket)
+{
+	// Adding a spectator again restarts its feed.
+	RemoveSpectator(session);
+	bool wasEmpty = m_entries.empty();
+	if (wasEmpty && !initialPacket) {
+		m_spectators.insert(session);
+		wasEmpty = false;
+	} else {
+		// Packets which are still pending were sent before the spectator joined.
+		FeedEntry entry;
+		entry.dueMsec = m_clock.elapsed().total_milliseconds() + m_delayMsec;
+		entry.packet = initialPacket;
+		entry.newSpectator = session;
+		m_entries.push_back(entry);
+	}
+	return wasEmpty;
+}
+
+void
+SpectatorFeed::RemoveSpectator(SessionId session)
+{
+	m_spectators.erase(session);
+	FeedEntryList::iterator i = m_entries.begin();
+	while (i != m_entries.end()) {
+		if (i->newSpectator == session)
+			i = m_entries.erase(i);
+		else
+			++i;
+	}
+}
+
+void
+SpectatorFeed::Clear()
+{
+	m_entries.clear();
+	m_spectators.clear();
+}
+
+unsigned
+SpectatorFeed::Flush(SessionManager &sessionManager, SenderHelper &sender)
+{
+	boost::uint64_t nowMsec = m_clock.elapsed().total_milliseconds();
+	NetPacketList packetList;
+	while (!m_entries.empty() && m_entries.front().dueMsec <= nowMsec) {
+		const FeedEntry &entry = m_entries.front();
+		if (entry.newSpectator == INVALID_SESSION) {
+			packetList.push_back(entry.packet);
+		} else {
+			InternalSend(sessionManager, sender, packetList);
+			packetList.clear();
+			if (entry.packet) {
+				boost::shared_ptr<SessionData> session(sessionManager.GetSessionById(entry.newSpectator));
+				if (session)
+					sender.Send(session, entry.packet);
+			}
+			m_spectators.insert(entry.newSpectator);
+		}
+		m_entries.pop_front();
+	}
+	InternalSend(sessionManager, sender, packetList);
+
+	unsigned retVal = 0;
+	if (!m_entries.empty())
+		retVal = static_cast<unsigned>(m_entries.front().dueMsec - nowMsec);
+	return retVal;
+}
+
+void
+SpectatorFeed::InternalSend(SessionManager &sessionManager, SenderHelper &sender, const NetPacketList &packetList)
+{
+	if (!packetList.empty()) {
+		SenderHelper::SessionList sessionList;
+		SpectatorSet::iterator i = m_spectators.begin();
+		while (i != m_spectators.end()) {
+			boost::shared_ptr<SessionData> session(sessionManager.GetSessionById(*i));
+			if (!session) {
+				// The session has left the game.
+				m_spectators.erase(i++);
+			} else {
+				if (session->GetState() == SessionData::Spectating)
+					sessionList.push_back(session);
+				++i;
+			}
+		}
+		sender.Send(sessionList, packetList);
+	}
+}
@@ -36,9 +36,15 @@
 
 using namespace std;
 
+static bool
+IsGameListRemoval(const NetPacket &packet)
+{
+	return packet.GetMsg()->messagetype() == PokerTHMessage::Type_GameListUpdateMessage
+		   && packet.GetMsg()->gamelistupdatemessage().gamemode() == netGameClosed;
+}
 
 WebSendBuffer::WebSendBuffer()
-	: closeAfterSend(false)
+	: closeAfterSend(false), overflow(false)
 {
 }
 
@@ -63,20 +69,61 @@ WebSendBuffer::AsyncSendNextPacket(boost::shared_ptr<SessionData> session)
 	}
 }
 
-void
+SendBuffer::StoreResult
 WebSendBuffer::InternalStorePacket(boost::shared_ptr<SessionData> session, boost::shared_ptr<NetPacket> packet)
 {
-	uint32_t packetSize = packet->GetMsg()->ByteSize();
-	google::protobuf::uint8 *buf = new google::protobuf::uint8[packetSize];
-	packet->GetMsg()->SerializeWithCachedSizesToArray(buf);
+	if (overflow) {
+		return STORE_DISCARDED;
+	}
+	boost::shared_ptr<WebSocketData> webData = session->GetWebData();
+	// Websocketpp buffers internally, check the amount of pending data.
+	size_t bufferedAmount = 0;
+	server::connection_ptr con;
+	{
+		boost::system::error_code ec;
+		con = webData->webSocketServer->get_con_from_hdl(webData->webHandle, ec);
+		if (!ec) {
+			bufferedAmount = con->get_buffered_amount();
+		}
+	}
+	if (bufferedAmount >= SEND_QUEUE_HARD_LIMIT) {
+		overflow = true;
+		return STORE_OVERFLOW;
+	}
+	if (packet->IsDroppable() && !IsGameListRemoval(*packet) && bufferedAmount >= SEND_QUEUE_SOFT_LIMIT) {
+		// There is no write completion notification, simply drop the update.
+		// Removed games are always sent, the client would keep them otherwise.
+		return STORE_DROPPED;
+	}
 
 	boost::system::error_code ec;
-	boost::shared_ptr<WebSocketData> webData = session->GetWebData();
-	webData->webSocketServer->send(webData->webHandle, string((const char *)buf, packetSize), websocketpp::frame::opcode::BINARY, ec);
+	if (con) {
+		// Serialize directly into the payload of the websocket message.
+		uint32_t packetSize = packet->GetMsg()->ByteSize();
+		server::message_ptr msg = con->get_message(websocketpp::frame::opcode::BINARY, packetSize);
+		string &payload = msg->get_raw_payload();
+		payload.resize(packetSize);
+		if (packetSize) {
+			packet->GetMsg()->SerializeWithCachedSizesToArray((google::protobuf::uint8 *)&payload[0]);
+		}
+		ec = con->send(msg);
+	} else {
+		// The connection is already gone.
+		ec = websocketpp::error::make_error_code(websocketpp::error::bad_connection);
+	}
 	if (ec) {
 		SetCloseAfterSend();
 	}
 
-	delete[] buf;
+	return STORE_OK;
+}
+
+bool
+WebSendBuffer::IsCongested(boost::shared_ptr<SessionData> session) const
+{
+	boost::shared_ptr<WebSocketData> webData = session->GetWebData();
+	boost::system::error_code ec;
+	server::connection_ptr con = webData->webSocketServer->get_con_from_hdl(webData->webHandle, ec);
+	return !ec && con->get_buffered_amount() >= SEND_QUEUE_SOFT_LIMIT;
 }
 
@@ -0,0 +1,108 @@
+/*****************************************************************************
+ * PokerTH - The open source texas holdem engine                             *
+ * Copyright (C) 2006-2013 Felix Hammer, Florian Thauer, Lothar May          *
+ *                                                                           *
+ * This program is free software: you can redistribute it and/or modify      *
+ * it under the terms of the GNU Affero General Public License as            *
+ * published by the Free Software Foundation, either version 3 of the        *
+ * License, or (at your option) any later version.                           *
+ *                                                                           *
+ * This program is distributed in the hope that it will be useful,           *
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of            *
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the             *
+ * GNU Affero General Public License for more details.                       *
+ *                                                                           *
+ * You should have received a copy of the GNU Affero General Public License  *
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.     *
+ *                                                                           *
+ *                                                                           *
+ * Additional permission under GNU AGPL version 3 section 7                  *
+ *                                                                           *
+ * If you modify this program, or any covered work, by linking or            *
+ * combining it with the OpenSSL project's OpenSSL library (or a             *
+ * modified version of that library), containing parts covered by the        *
+ * terms of the OpenSSL or SSLeay licenses, the authors of PokerTH           *
+ * (Felix Hammer, Florian Thauer, Lothar May) grant you additional           *
+ * permission to convey the resulting work.                                  *
+ * Corresponding Source for a non-source form of such a combination          *
+ * shall include the source code for the parts of OpenSSL used as well       *
+ * as that of the covered work.                                              *
+ *****************************************************************************/
+/* Hashed timing wheel for the timers of the game states. */
+
+#ifndef _GAMETIMERWHEEL_H_
+#define _GAMETIMERWHEEL_H_
+
+#include <boost/asio.hpp>
+#include <boost/thread.hpp>
+#include <boost/function.hpp>
+#include <boost/noncopyable.hpp>
+#include <boost/enable_shared_from_this.hpp>
+#include <boost/unordered_map.hpp>
+#include <list>
+#include <vector>
+
+#define GAME_TIMER_TICK_MSEC				50
+#define GAME_TIMER_NUM_SLOTS				1024
+
+// The timers of all games share a single asio timer, which is only
+// running while timers are scheduled.
+class GameTimerWheel : public boost::enable_shared_from_this<GameTimerWheel>
+{
+public:
+	typedef boost::function<void (const boost::system::error_code &)> Handler;
+
+	GameTimerWheel(boost::shared_ptr<boost::asio::io_service> ioService);
+	virtual ~GameTimerWheel();
+
+	void Stop();
+
+	// Returns an id which can be used to cancel the timer.
+	unsigned Schedule(const boost::posix_time::time_duration &delay, const Handler &handler);
+	void Cancel(unsigned timerId);
+
+protected:
+	struct WheelEntry {
+		unsigned timerId;
+		unsigned rounds;
+		Handler handler;
+	};
+	typedef std::list<WheelEntry> WheelSlot;
+	struct TimerPos {
+		unsigned slot;
+		WheelSlot::iterator pos;
+	};
+	typedef boost::unordered_map<unsigned, TimerPos> TimerPosMap;
+	typedef std::list<Handler> HandlerList;
+
+	void TimerTick(const boost::system::error_code &ec);
+
+private:
+	boost::shared_ptr<boost::asio::io_service> m_ioService;
+	boost::asio::deadline_timer m_tickTimer;
+	bool m_tickTimerRunning;
+
+	std::vector<WheelSlot> m_wheel;
+	unsigned m_curSlot;
+	TimerPosMap m_timerPos;
+	unsigned m_curTimerId;
+	mutable boost::mutex m_wheelMutex;
+};
+
+// A single timer of a game state. Starting the timer cancels any
+// pending handler. Cancelled handlers are not called.
+class GameTimer : private boost::noncopyable
+{
+public:
+	GameTimer(boost::shared_ptr<GameTimerWheel> wheel);
+	~GameTimer();
+
+	void Start(const boost::posix_time::time_duration &delay, const GameTimerWheel::Handler &handler);
+	void Cancel();
+
+private:
+	boost::shared_ptr<GameTimerWheel> m_wheel;
+	unsigned m_timerId;
+};
+
+#endif
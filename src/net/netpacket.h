@@ -40,14 +40,31 @@
 #include <gamedata.h>
 
 #define NET_VERSION_MAJOR			5
-#define NET_VERSION_MINOR			1
+#define NET_VERSION_MINOR			2
+
+// Clients with at least this minor version receive the lobby state as snapshot.
+#define NET_VERSION_MINOR_LOBBY_SNAPSHOT	2
+// Clients with at least this minor version receive avatars in large chunks.
+#define NET_VERSION_MINOR_LARGE_AVATAR_CHUNKS	2
 
 #define NET_HEADER_SIZE				4
 
 #define MAX_FILE_DATA_SIZE			256
+#define MAX_AVATAR_CHUNK_SIZE		16384
+#define MAX_AVATAR_PACKET_SIZE		(MAX_AVATAR_CHUNK_SIZE + 64)
 #define MAX_PACKET_SIZE				384
 #define MAX_CHAT_TEXT_SIZE			128
 
+// Packets are only compressed if their total size is at least this large.
+#define NET_COMPRESS_MIN_DATA_SIZE	512
+#define MAX_UNCOMPRESSED_DATA_SIZE	32768
+#define MAX_COMPRESSED_PACKET_SIZE	(MAX_UNCOMPRESSED_DATA_SIZE + 64)
+
+// Maximum number of cleared messages which are kept for reuse.
+#define NET_MSG_POOL_MAX_SIZE		512
+// Larger messages are not reused, they would keep their memory.
+#define NET_MSG_POOL_MAX_MSG_SIZE	1024
+
 /*#define MIN_PACKET_SIZE				4
 #define MAX_NAME_SIZE				64
 #define MAX_PASSWORD_SIZE			64
@@ -55,6 +72,9 @@
 #define MAX_NUM_PLAYER_RESULTS		MAX_NUMBER_OF_PLAYERS
 #define MAX_NUM_PLAYER_CARDS		MAX_NUMBER_OF_PLAYERS*/
 
+class NetPacket;
+typedef std::list<boost::shared_ptr<NetPacket> > NetPacketList;
+
 // This is just a wrapper class for the protocol buffer.
 class NetPacket
 {
@@ -65,6 +85,17 @@ public:
 
 	static boost::shared_ptr<NetPacket> Create(const char *data, size_t dataSize);
 
+	// Combine packets to compressed packets where this saves bandwidth.
+	// Returns the number of bytes saved.
+	static size_t Compress(const NetPacketList &inList, NetPacketList &outList);
+	// Fails if one of the contained packets is larger than maxPacketSize.
+	static bool Decompress(const NetPacket &packet, NetPacketList &outList, size_t maxPacketSize);
+
+	// Messages are recycled after use. Clearing a protocol buffer message
+	// keeps the memory of its sub messages, strings and repeated fields.
+	static PokerTHMessage *AllocMsg();
+	static void ReleaseMsg(PokerTHMessage *msg);
+
 	const PokerTHMessage *GetMsg() const {
 		return m_msg;
 	}
@@ -73,7 +104,12 @@ public:
 	}
 
 	bool IsClientActivity() const;
+	// Lobby updates which may be coalesced or dropped if a client is slow.
+	bool IsDroppable() const;
+	unsigned GetDroppableKey() const;
 
+	// Appends the packet as it is sent over TCP, i.e. with size header.
+	void AppendEncodedData(std::string &data) const;
 	std::string ToString() const;
 
 	static void SetGameData(const GameData &inData, NetGameInfo &outData);
@@ -86,7 +122,5 @@ private:
 	PokerTHMessage *m_msg;
 };
 
-typedef std::list<boost::shared_ptr<NetPacket> > NetPacketList;
-
 #endif
 
@@ -33,10 +33,11 @@
 #ifndef _NETPACKETVALIDATOR_H_
 #define _NETPACKETVALIDATOR_H_
 
-#include <map>
+#include <vector>
 
 class NetPacket;
 class NetGameInfo;
+class GameListNewMessage;
 
 class NetPacketValidator
 {
@@ -127,14 +128,18 @@ protected:
 	static bool ValidateGameListSpectatorLeftMessage(const NetPacket &packet);
 	static bool ValidateGameSpectatorJoinedMessage(const NetPacket &packet);
 	static bool ValidateGameSpectatorLeftMessage(const NetPacket &packet);
+	static bool ValidateLobbySnapshotMessage(const NetPacket &packet);
+	static bool ValidateCompressedPacketsMessage(const NetPacket &packet);
 
 	static bool ValidateGameInfo(const NetGameInfo &gameInfo);
+	static bool ValidateGameListNew(const GameListNewMessage &gameListNew);
 
 	typedef bool (*ValidateFunctor)(const NetPacket &);
-	typedef std::map<int, ValidateFunctor> ValidateFunctorMap;
+	// Dense table indexed by the message type.
+	typedef std::vector<ValidateFunctor> ValidateFunctorTable;
 private:
 
-	ValidateFunctorMap m_validationMap;
+	ValidateFunctorTable m_validationTable;
 };
 
 #endif
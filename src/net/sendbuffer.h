@@ -36,6 +36,13 @@
 #include <net/websocket_defs.h>
 #include <boost/enable_shared_from_this.hpp>
 #include <boost/thread.hpp>
+#include <string>
+
+// Droppable packets are coalesced if more than this amount of data is pending.
+#define SEND_QUEUE_SOFT_LIMIT				65536
+// Sessions are closed if more data or more packets are pending.
+#define SEND_QUEUE_HARD_LIMIT				1048576
+#define SEND_QUEUE_MAX_PACKETS				8192
 
 class SessionData;
 class NetPacket;
@@ -43,12 +50,20 @@ class NetPacket;
 class SendBuffer : public boost::enable_shared_from_this<SendBuffer>
 {
 public:
+	enum StoreResult { STORE_OK, STORE_DROPPED, STORE_DISCARDED, STORE_OVERFLOW };
+
 	virtual ~SendBuffer();
 
 	virtual void SetCloseAfterSend() = 0;
 
 	virtual void AsyncSendNextPacket(boost::shared_ptr<SessionData> session) = 0;
-	virtual void InternalStorePacket(boost::shared_ptr<SessionData> session, boost::shared_ptr<NetPacket> packet) = 0;
+	// Returns STORE_OVERFLOW only once, further packets are discarded.
+	virtual StoreResult InternalStorePacket(boost::shared_ptr<SessionData> session, boost::shared_ptr<NetPacket> packet) = 0;
+	// Same as above, but the packet was already encoded by the caller (with
+	// size header), so that many sessions can share the encoded data.
+	virtual StoreResult InternalStoreEncodedPacket(boost::shared_ptr<SessionData> session, boost::shared_ptr<NetPacket> packet, const std::string &encodedData);
+	// Returns true if droppable packets are currently being coalesced or dropped.
+	virtual bool IsCongested(boost::shared_ptr<SessionData> session) const = 0;
 
 	virtual void HandleWrite(boost::shared_ptr<boost::asio::ip::tcp::socket> socket, const boost::system::error_code &error) = 0;
 
@@ -34,25 +34,81 @@
 #define _SENDERHELPER_H_
 
 #include <boost/asio.hpp>
+#include <boost/thread.hpp>
+#include <boost/cstdint.hpp>
+#include <set>
+#include <vector>
 #include <net/netpacket.h>
 
 class SessionData;
 class SendBuffer;
 
+struct SendStats {
+	SendStats() : numDroppedPackets(0), numEvictedSessions(0), numCompressionSavedBytes(0) {}
+	unsigned numDroppedPackets;
+	unsigned numEvictedSessions;
+	boost::uint64_t numCompressionSavedBytes;
+};
+
 class SenderHelper
 {
 public:
+	typedef std::vector<boost::shared_ptr<SessionData> > SessionList;
+
 	SenderHelper(boost::shared_ptr<boost::asio::io_service> ioService);
 	~SenderHelper();
 
 	void Send(boost::shared_ptr<SessionData> session, boost::shared_ptr<NetPacket> packet);
+	// Packet lists are compressed if the session supports it.
 	void Send(boost::shared_ptr<SessionData> session, const NetPacketList &packetList);
+	// Sends the same packets to many sessions, compressing and encoding them
+	// only once.
+	void Send(const SessionList &sessionList, const NetPacketList &packetList);
 
 	void SetCloseAfterSend(boost::shared_ptr<SessionData> session);
 
+	SendStats GetStats() const;
+
+	// While a batch is active, packets are only stored. Each session which
+	// received packets is flushed once when the outermost batch ends.
+	void StartBatch();
+	void EndBatch();
+
+protected:
+	typedef std::set<boost::shared_ptr<SessionData> > SessionSet;
+	typedef std::vector<std::string> EncodedPacketList;
+
+	static void EncodePackets(const NetPacketList &packetList, EncodedPacketList &encodedList);
+	void InternalSend(boost::shared_ptr<SessionData> session, const NetPacketList &packetList, const NetPacketList *compressedList, size_t bytesSaved,
+					  const EncodedPacketList *encodedList = NULL, const EncodedPacketList *encodedCompressedList = NULL);
+	bool DeferAsyncSend(boost::shared_ptr<SessionData> session);
+	void InternalHandleStoreResult(boost::shared_ptr<SessionData> session, int result);
+
 private:
 
 	boost::shared_ptr<boost::asio::io_service> m_ioService;
+
+	SessionSet m_batchSessions;
+	unsigned m_batchDepth;
+	mutable boost::mutex m_batchMutex;
+
+	SendStats m_stats;
+	mutable boost::mutex m_statMutex;
+};
+
+// Helper class to end a send batch even if an exception is thrown.
+class SenderBatch
+{
+public:
+	SenderBatch(SenderHelper &sender) : m_sender(sender) {
+		m_sender.StartBatch();
+	}
+	~SenderBatch() {
+		m_sender.EndBatch();
+	}
+
+private:
+	SenderHelper &m_sender;
 };
 
 #endif
@@ -120,8 +120,15 @@ protected:
 			acceptedSocket->io_control(command);
 			acceptedSocket->set_option(typename P::no_delay(true));
 			acceptedSocket->set_option(boost::asio::socket_base::keep_alive(true));
-			boost::shared_ptr<SessionData> sessionData(new SessionData(acceptedSocket, m_lobbyThread->GetNextSessionId(), m_lobbyThread->GetSessionDataCallback(), *m_ioService));
-			GetLobbyThread().AddConnection(sessionData);
+			// Reject banned or flooding addresses before creating a session.
+			boost::system::error_code ec;
+			P_endpoint remoteEndpoint = acceptedSocket->remote_endpoint(ec);
+			if (!ec && !GetLobbyThread().IsConnectionAllowed(remoteEndpoint.address())) {
+				acceptedSocket->close(ec);
+			} else {
+				boost::shared_ptr<SessionData> sessionData(new SessionData(acceptedSocket, m_lobbyThread->GetNextSessionId(), m_lobbyThread->GetSessionDataCallback(), MAX_PACKET_SIZE));
+				GetLobbyThread().AddConnection(sessionData);
+			}
 
 			boost::shared_ptr<typename P::socket> newSocket(new typename P::socket(*m_ioService));
 			m_acceptor->async_accept(
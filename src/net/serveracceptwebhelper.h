@@ -33,6 +33,7 @@
 #ifndef _SERVERACCEPTWEBHELPER_H_
 #define _SERVERACCEPTWEBHELPER_H_
 
+#include <boost/unordered_map.hpp>
 #include <net/websocket_defs.h>
 #include <net/serveracceptinterface.h>
 #include <net/serverlobbythread.h>
@@ -50,7 +51,10 @@ public:
 
 protected:
 
-	typedef std::map<websocketpp::connection_hdl, boost::weak_ptr<SessionData> > SessionMap;
+	// Connections are indexed by the address of their connection object.
+	typedef boost::unordered_map<const void *, boost::weak_ptr<SessionData> > SessionMap;
+
+	static const void *GetHandleKey(websocketpp::connection_hdl hdl);
 
 	bool validate(websocketpp::connection_hdl hdl);
 	void on_open(websocketpp::connection_hdl hdl);
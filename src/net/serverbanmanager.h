@@ -39,6 +39,7 @@
 #include <boost/thread.hpp>
 #include <boost/enable_shared_from_this.hpp>
 #include <map>
+#include <set>
 #include <list>
 #include <string>
 
@@ -52,7 +53,8 @@ public:
 
 	void BanPlayerName(const std::string &playerName, unsigned durationHours = 0);
 	void BanPlayerRegex(const std::string &playerRegex, unsigned durationHours = 0);
-	void BanIPAddress(const std::string &ipAddress, unsigned durationHours);
+	// The address may be a single address or a CIDR range (e.g. 10.0.0.0/8).
+	bool BanIPAddress(const std::string &ipAddress, unsigned durationHours);
 	bool UnBan(unsigned banId);
 	void GetBanList(std::list<std::string> &list) const;
 	void ClearBanList();
@@ -60,6 +62,7 @@ public:
 	bool IsAdminPlayer(DB_id playerId) const;
 	bool IsPlayerBanned(const std::string &name) const;
 	bool IsIPAddressBanned(const std::string &ipAddress) const;
+	bool IsIPAddressBanned(const boost::asio::ip::address &ipAddress) const;
 
 	void InitGameNameBadWordList(const std::list<std::string> &badWordList);
 	bool IsBadGameName(const std::string &name) const;
@@ -74,14 +77,30 @@ protected:
 	struct TimedIPBan {
 		boost::shared_ptr<boost::asio::deadline_timer> timer;
 		std::string ipAddress;
+		boost::asio::ip::address_v6::bytes_type prefix;
+		unsigned prefixLength;
+	};
+	// Node of the binary prefix tree for IP bans.
+	struct IPBanNode {
+		IPBanNode() : banned(false) {
+			child[0] = child[1] = 0;
+		}
+		unsigned child[2];
+		bool banned;
 	};
 
 	typedef std::map<unsigned, TimedPlayerBan> RegexMap;
 	typedef std::map<unsigned, TimedIPBan> IPAddressMap;
-	typedef std::list<boost::regex> RegexList;
+	typedef std::multiset<std::string> NameSet;
+	typedef std::vector<IPBanNode> IPBanTree;
 	typedef std::vector<DB_id> DBPlayerIdList;
 
 	boost::shared_ptr<boost::asio::deadline_timer> InternalRegisterTimedBan(unsigned timerId, unsigned durationHours);
+	void InternalRebuildBanIndex();
+	void InternalRebuildIPBanIndex();
+	static bool ParseIPRange(const std::string &ipRange, boost::asio::ip::address_v6::bytes_type &outPrefix, unsigned &outPrefixLength);
+	static boost::asio::ip::address_v6::bytes_type ToV6Bytes(const boost::asio::ip::address &ipAddress);
+	static bool CombineRegexList(const std::list<std::string> &regexList, boost::regex &outRegex);
 	void TimerRemoveBan(const boost::system::error_code &ec, unsigned banId, boost::shared_ptr<boost::asio::deadline_timer> timer);
 
 	boost::shared_ptr<boost::asio::io_service> m_ioService;
@@ -90,8 +109,16 @@ protected:
 
 private:
 	RegexMap m_banPlayerNameMap;
-	RegexList m_gameNameBadWordFilter;
+	// Index for the name bans: Plain names are looked up in a set,
+	// the regular expressions are combined to a single expression.
+	NameSet m_banPlayerNames;
+	boost::regex m_banPlayerRegex;
+	bool m_hasBanPlayerRegex;
+	boost::regex m_gameNameBadWordRegex;
+	bool m_hasGameNameBadWordRegex;
 	IPAddressMap m_banIPAddressMap;
+	// All IP addresses are stored as IPv6 (IPv4 is mapped), node 0 is the root.
+	IPBanTree m_banIPTree;
 	DBPlayerIdList m_adminPlayers;
 	unsigned m_curBanId;
 	mutable boost::mutex m_banMutex;
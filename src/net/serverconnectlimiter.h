@@ -0,0 +1,82 @@
+/*****************************************************************************
+ * PokerTH - The open source texas holdem engine                             *
+ * Copyright (C) 2006-2013 Felix Hammer, Florian Thauer, Lothar May          *
+ *                                                                           *
+ * This program is free software: you can redistribute it and/or modify      *
+ * it under the terms of the GNU Affero General Public License as            *
+ * published by the Free Software Foundation, either version 3 of the        *
+ * License, or (at your option) any later version.                           *
+ *                                                                           *
+ * This program is distributed in the hope that it will be useful,           *
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of            *
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the             *
+ * GNU Affero General Public License for more details.                       *
+ *                                                                           *
+ * You should have received a copy of the GNU Affero General Public License  *
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.     *
+ *                                                                           *
+ *                                                                           *
+ * Additional permission under GNU AGPL version 3 section 7                  *
+ *                                                                           *
+ * If you modify this program, or any covered work, by linking or            *
+ * combining it with the OpenSSL project's OpenSSL library (or a             *
+ * modified version of that library), containing parts covered by the        *
+ * terms of the OpenSSL or SSLeay licenses, the authors of PokerTH           *
+ * (Felix Hammer, Florian Thauer, Lothar May) grant you additional           *
+ * permission to convey the resulting work.                                  *
+ * Corresponding Source for a non-source form of such a combination          *
+ * shall include the source code for the parts of OpenSSL used as well       *
+ * as that of the covered work.                                              *
+ *****************************************************************************/
+/* Token bucket rate limiter for incoming connections. */
+
+#ifndef _SERVERCONNECTLIMITER_H_
+#define _SERVERCONNECTLIMITER_H_
+
+#include <boost/asio.hpp>
+#include <boost/thread.hpp>
+#include <boost/cstdint.hpp>
+#include <boost/unordered_map.hpp>
+#include <third_party/boost/timers.hpp>
+#include <string>
+
+// Connections per minute and burst size, per address and per subnet
+// (/24 for IPv4, /64 for IPv6).
+#define SERVER_CONNECT_ADDRESS_RATE_PER_MIN		30
+#define SERVER_CONNECT_ADDRESS_BURST			10
+#define SERVER_CONNECT_SUBNET_RATE_PER_MIN		120
+#define SERVER_CONNECT_SUBNET_BURST				40
+// Upper bound for the number of buckets of each kind.
+#define SERVER_CONNECT_MAX_BUCKETS				65536
+
+class ServerConnectLimiter
+{
+public:
+	ServerConnectLimiter();
+	virtual ~ServerConnectLimiter();
+
+	// Consumes a token for the address and its subnet.
+	// Loopback addresses are never limited.
+	bool IsConnectAllowed(const boost::asio::ip::address &ipAddress);
+
+protected:
+	struct TokenBucket {
+		// Tokens are stored in units of 1/1000.
+		unsigned milliTokens;
+		boost::uint64_t lastUpdateMsec;
+	};
+	typedef boost::unordered_map<std::string, TokenBucket> BucketMap;
+
+	bool InternalConsumeToken(BucketMap &buckets, const std::string &key, unsigned ratePerMin, unsigned burst, boost::uint64_t nowMsec);
+	static void InternalRefill(TokenBucket &bucket, unsigned ratePerMin, unsigned burst, boost::uint64_t nowMsec);
+	static void InternalPurgeFullBuckets(BucketMap &buckets, unsigned ratePerMin, unsigned burst, boost::uint64_t nowMsec);
+
+private:
+	BucketMap m_addressBuckets;
+	BucketMap m_subnetBuckets;
+	boost::uint64_t m_lastPurgeMsec;
+	boost::timers::portable::microsec_timer m_clock;
+	mutable boost::mutex m_bucketMutex;
+};
+
+#endif
@@ -38,6 +38,8 @@
 #include <map>
 
 #include <net/sessionmanager.h>
+#include <net/gametimerwheel.h>
+#include <net/spectatorfeed.h>
 #include <db/serverdbcallback.h>
 #include <gui/guiinterface.h>
 #include <gamedata.h>
@@ -79,6 +81,10 @@ public:
 
 	void SendToAllPlayers(boost::shared_ptr<NetPacket> packet, int state);
 	void SendToAllButOnePlayers(boost::shared_ptr<NetPacket> packet, SessionId except, int state);
+	// Spectators receive packets through the spectator feed.
+	void AddFeedSpectator(SessionId session, boost::shared_ptr<NetPacket> initialPacket = boost::shared_ptr<NetPacket>());
+	// Packets of the hand are reused. The caller sets all fields which vary.
+	boost::shared_ptr<NetPacket> GetHandPacket(PokerTHMessage::PokerTHMessageType type);
 	void RemoveAllSessions();
 	void MoveSpectatorsToLobby();
 
@@ -137,6 +143,11 @@ protected:
 	typedef std::map<unsigned, RankingData> RankingMap;
 
 	void TimerVoteKick(const boost::system::error_code &ec);
+	void TimerSpectatorFeed(const boost::system::error_code &ec);
+	// The lobby caches the game list packet until the game changes.
+	void InvalidateGameListPacket();
+	void InternalSendToSpectators(boost::shared_ptr<NetPacket> packet);
+	void InternalStartSpectatorFeedTimer();
 
 	PlayerDataList InternalStartGame();
 	void InitRankingMap(const PlayerDataList &playerDataList);
@@ -177,8 +188,8 @@ protected:
 	ServerGameState &GetState();
 	void SetState(ServerGameState &newState);
 
-	boost::asio::deadline_timer &GetStateTimer1();
-	boost::asio::deadline_timer &GetStateTimer2();
+	GameTimer &GetStateTimer1();
+	GameTimer &GetStateTimer2();
 
 	const StartData &GetStartData() const;
 	void SetStartData(const StartData &startData);
@@ -238,10 +249,18 @@ private:
 	unsigned			m_gameNum;
 	unsigned			m_curPetitionId;
 	boost::asio::deadline_timer m_voteKickTimer;
-	boost::asio::deadline_timer m_stateTimer1;
-	boost::asio::deadline_timer m_stateTimer2;
+	GameTimer			m_stateTimer1;
+	GameTimer			m_stateTimer2;
+	SpectatorFeed		m_spectatorFeed;
+	GameTimer			m_spectatorFeedTimer;
 	bool				m_isNameReported;
 
+	typedef std::map<int, boost::shared_ptr<NetPacket> > HandPacketMap;
+	HandPacketMap		m_handPackets;
+	boost::shared_ptr<NetPacket> m_rejoinSnapshot;
+	boost::shared_ptr<NetPacket> m_gameListPacket;
+	int					m_rejoinSnapshotHandId;
+
 	friend class ServerLobbyThread;
 	friend class AbstractServerGameStateReceiving;
 	friend class AbstractServerGameStateRunning;
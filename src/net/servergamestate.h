@@ -82,7 +82,7 @@ public:
 	static boost::shared_ptr<NetPacket> CreateNetPacketPlayerJoined(unsigned gameId, const PlayerData &playerData);
 	static boost::shared_ptr<NetPacket> CreateNetPacketSpectatorJoined(unsigned gameId, const PlayerData &playerData);
 	static boost::shared_ptr<NetPacket> CreateNetPacketJoinGameAck(const ServerGame &server, const PlayerData &playerData, bool spectateOnly);
-	static boost::shared_ptr<NetPacket> CreateNetPacketHandStart(const ServerGame &server);
+	static boost::shared_ptr<NetPacket> CreateNetPacketHandStart(ServerGame &server);
 
 	static void AcceptNewSession(boost::shared_ptr<ServerGame> server, boost::shared_ptr<SessionData> session, bool spectateOnly);
 
@@ -182,11 +182,14 @@ protected:
 	virtual void InternalProcessPacket(boost::shared_ptr<ServerGame> server, boost::shared_ptr<SessionData> session, boost::shared_ptr<NetPacket> packet);
 	void TimerLoop(const boost::system::error_code &ec, boost::shared_ptr<ServerGame> server);
 	void EngineLoop(boost::shared_ptr<ServerGame> server);
+	bool EngineStep(boost::shared_ptr<ServerGame> server);
 	void TimerShowCards(const boost::system::error_code &ec, boost::shared_ptr<ServerGame> server);
 	void TimerComputerAction(const boost::system::error_code &ec, boost::shared_ptr<ServerGame> server);
 	void TimerNextHand(const boost::system::error_code &ec, boost::shared_ptr<ServerGame> server);
 	void TimerNextGame(const boost::system::error_code &ec, boost::shared_ptr<ServerGame> server, unsigned winnerPlayerId);
 	int GetDealCardsDelaySec(ServerGame &server);
+	// True if all humans watching the table accepted hands without pacing.
+	static bool IsFastForward(ServerGame &server);
 	static void StartNewHand(boost::shared_ptr<ServerGame> server);
 	static void CheckPlayerTimeouts(boost::shared_ptr<ServerGame> server);
 	static void ReactivatePlayers(boost::shared_ptr<ServerGame> server);
@@ -194,6 +197,10 @@ protected:
 	static void InitNewSpectators(boost::shared_ptr<ServerGame> server);
 	static void PerformRejoin(boost::shared_ptr<ServerGame> server, boost::shared_ptr<SessionData> session);
 	static void SendGameData(boost::shared_ptr<ServerGame> server, boost::shared_ptr<SessionData> session);
+	// Rejoins only happen at the start of a hand, so the game state is
+	// built once per hand and patched when player ids change.
+	static boost::shared_ptr<NetPacket> GetRejoinSnapshot(ServerGame &server);
+	static void PatchRejoinSnapshot(ServerGame &server, unsigned oldPlayerId, unsigned newPlayerId);
 
 private:
 	static ServerGameStateHand s_state;
@@ -36,6 +36,7 @@
 #include <boost/asio.hpp>
 #include <boost/enable_shared_from_this.hpp>
 #include <boost/uuid/uuid_generators.hpp>
+#include <boost/unordered_set.hpp>
 
 #include <net/sessionmanager.h>
 #include <net/netpacket.h>
@@ -48,10 +49,13 @@
 
 
 class SenderHelper;
+class SessionTimerWheel;
+class GameTimerWheel;
 class InternalServerCallback;
 class ServerIrcBotCallback;
 class ServerGame;
 class ServerBanManager;
+class ServerConnectLimiter;
 class ConfigFile;
 class AvatarManager;
 class ChatCleanerManager;
@@ -86,6 +90,7 @@ public:
 	void NotifyReopeningGame(unsigned gameId);
 
 	void DispatchPacket(boost::shared_ptr<SessionData> session, boost::shared_ptr<NetPacket> packet);
+	void DispatchPacketBatch(boost::shared_ptr<SessionData> session, const NetPacketList &packetList);
 	void HandleGameRetrievePlayerInfo(boost::shared_ptr<SessionData> session, const PlayerInfoRequestMessage &playerInfoRequest);
 	void HandleGameRetrieveAvatar(boost::shared_ptr<SessionData> session, const AvatarRequestMessage &retrieveAvatar);
 	void HandleGameReportGame(boost::shared_ptr<SessionData> session, const ReportGameMessage &reportGame);
@@ -122,11 +127,19 @@ public:
 	ServerStats GetStats() const;
 	boost::posix_time::ptime GetStartTime() const;
 	ServerMode GetServerMode() const;
+	// Hands without human observers may be run without pacing delays.
+	bool IsFastForwardEnabled() const;
+	// Delay of the game feed for spectators.
+	unsigned GetSpectatorDelaySec() const;
 
 	SenderHelper &GetSender();
 	boost::asio::io_service &GetIOService();
 	boost::shared_ptr<ServerDBInterface> GetDatabase();
 	ServerBanManager &GetBanManager();
+	// Checked for new connections before a session is created.
+	bool IsConnectionAllowed(const boost::asio::ip::address &ipAddress);
+	SessionTimerWheel &GetSessionTimers();
+	boost::shared_ptr<GameTimerWheel> GetGameTimers();
 
 	SessionDataCallback &GetSessionDataCallback();
 
@@ -137,6 +150,8 @@ protected:
 	typedef std::list<SessionId> SessionIdList;
 	typedef std::map<SessionId, boost::timers::portable::microsec_timer> TimerSessionMap;
 	typedef std::map<unsigned, boost::shared_ptr<ServerGame> > GameMap;
+	// Names of all games in the game map.
+	typedef boost::unordered_multiset<std::string> GameNameSet;
 	typedef std::map<std::string, boost::timers::portable::microsec_timer> TimerClientAddressMap;
 	typedef std::list<unsigned> RemoveGameList;
 
@@ -185,6 +200,7 @@ protected:
 	void TimerRemovePlayer(const boost::system::error_code &ec);
 	void TimerUpdateClientLoginLock(const boost::system::error_code &ec);
 	void TimerCleanupAvatarCache(const boost::system::error_code &ec);
+	void TimerFlushLobbyNotifications(const boost::system::error_code &ec);
 
 	bool IsGameNameInUse(const std::string &gameName) const;
 	boost::shared_ptr<ServerGame> InternalGetGameFromId(unsigned gameId);
@@ -203,8 +219,13 @@ protected:
 	void CloseSession(boost::shared_ptr<SessionData> session);
 	void SendError(boost::shared_ptr<SessionData> s, int errorCode);
 	void SendJoinGameFailed(boost::shared_ptr<SessionData> s, unsigned gameId, int reason);
+	void QueueLobbyNotification(boost::shared_ptr<NetPacket> packet);
+	void FlushLobbyNotifications();
+	void SendLobbyState(boost::shared_ptr<SessionData> s);
+	void SendLobbySnapshot(boost::shared_ptr<SessionData> s);
 	void SendPlayerList(boost::shared_ptr<SessionData> s);
 	void SendGameList(boost::shared_ptr<SessionData> s);
+	PlayerIdList GetLobbyPlayerIdList() const;
 	void UpdateStatisticsNumberOfPlayers();
 	void BroadcastStatisticsUpdate(const ServerStats &stats);
 
@@ -220,6 +241,10 @@ protected:
 	static boost::shared_ptr<NetPacket> CreateNetPacketPlayerListNew(unsigned playerId);
 	static boost::shared_ptr<NetPacket> CreateNetPacketPlayerListLeft(unsigned playerId);
 	static boost::shared_ptr<NetPacket> CreateNetPacketGameListNew(const ServerGame &game);
+	// Returns the cached packet of the game, which is rebuilt after changes.
+	static boost::shared_ptr<NetPacket> GetGameListNewPacket(ServerGame &game);
+	static boost::shared_ptr<NetPacket> CreateNetPacketLobbySnapshot();
+	static void SetGameListNewData(const ServerGame &game, GameListNewMessage &netGameList);
 	static boost::shared_ptr<NetPacket> CreateNetPacketGameListUpdate(unsigned gameId, GameMode mode);
 
 	u_int32_t GetRejoinGameIdForPlayer(const std::string &playerName, const std::string &guid, unsigned &outPlayerUniqueId);
@@ -230,6 +255,8 @@ private:
 
 	boost::shared_ptr<InternalServerCallback> m_internalServerCallback;
 	boost::shared_ptr<SenderHelper> m_sender;
+	boost::shared_ptr<SessionTimerWheel> m_sessionTimers;
+	boost::shared_ptr<GameTimerWheel> m_gameTimers;
 
 	SessionManager m_sessionManager;
 	SessionManager m_gameSessionManager;
@@ -246,6 +273,7 @@ private:
 	mutable boost::mutex m_computerPlayersMutex;
 
 	GameMap m_gameMap;
+	GameNameSet m_gameNames;
 
 	GuiInterface &m_gui;
 	ServerIrcBotCallback &m_ircBotCb;
@@ -265,12 +293,18 @@ private:
 	mutable boost::mutex m_statMutex;
 
 	boost::shared_ptr<ServerBanManager> m_banManager;
+	boost::shared_ptr<ServerConnectLimiter> m_connectLimiter;
 	boost::shared_ptr<ChatCleanerManager> m_chatCleanerManager;
 	boost::shared_ptr<ServerDBInterface> m_database;
 
 	boost::asio::deadline_timer m_removeGameTimer;
 	boost::asio::deadline_timer m_saveStatisticsTimer;
 	boost::asio::deadline_timer m_loginLockTimer;
+	boost::asio::deadline_timer m_lobbyNotifyTimer;
+	NetPacketList m_lobbyNotifyList;
+	const unsigned m_lobbyNotifyIntervalMsec;
+	const bool m_fastForwardGames;
+	const unsigned m_spectatorDelaySec;
 
 	boost::uuids::random_generator m_sessionIdGenerator;
 
@@ -61,8 +61,8 @@ class SessionData : public boost::enable_shared_from_this<SessionData>
 public:
 	enum State { Init = 1, ReceivingAvatar = 2, Established = 4, Game = 8, Spectating = 16, SpectatorWaiting = 32, Closed = 128 };
 
-	SessionData(boost::shared_ptr<boost::asio::ip::tcp::socket> sock, SessionId id, SessionDataCallback &cb, boost::asio::io_service &ioService);
-	SessionData(boost::shared_ptr<WebSocketData> webData, SessionId id, SessionDataCallback &cb, boost::asio::io_service &ioService, int filler);
+	SessionData(boost::shared_ptr<boost::asio::ip::tcp::socket> sock, SessionId id, SessionDataCallback &cb, size_t maxRecvPacketSize);
+	SessionData(boost::shared_ptr<WebSocketData> webData, SessionId id, SessionDataCallback &cb, int filler);
 	~SessionData();
 
 	SessionId GetId() const;
@@ -91,6 +91,12 @@ public:
 	void SetWantsLobbyMsg();
 	void ResetWantsLobbyMsg();
 	bool WantsLobbyMsg() const;
+	void SetProtocolMinorVersion(unsigned minorVersion);
+	unsigned GetProtocolMinorVersion() const;
+	void SetCompressionEnabled(bool enabled);
+	bool IsCompressionEnabled() const;
+	void SetFastForwardAccepted(bool accepted);
+	bool IsFastForwardAccepted() const;
 
 	const std::string &GetClientAddr() const;
 	void SetClientAddr(const std::string &addr);
@@ -110,13 +116,9 @@ public:
 	void HandlePacket(boost::shared_ptr<NetPacket> packet) {
 		m_callback.HandlePacket(shared_from_this(), packet);
 	}
-
-	void ResetActivityTimer();
-
-	void StartTimerInitTimeout(unsigned timeoutSec);
-	void StartTimerGlobalTimeout(unsigned timeoutSec);
-	void StartTimerActivityTimeout(unsigned timeoutSec, unsigned warningRemainingSec);
-	void CancelTimers();
+	void HandlePacketBatch(const std::list<boost::shared_ptr<NetPacket> > &packetList) {
+		m_callback.HandlePacketBatch(shared_from_this(), packetList);
+	}
 
 	void SetPlayerData(boost::shared_ptr<PlayerData> player);
 	boost::shared_ptr<PlayerData> GetPlayerData();
@@ -127,9 +129,6 @@ protected:
 	SessionData(const SessionData &other);
 	SessionData &operator=(const SessionData &other);
 	void InternalClearAuthSession();
-	void TimerInitTimeout(const boost::system::error_code &ec);
-	void TimerSessionTimeout(const boost::system::error_code &ec);
-	void TimerActivityWarning(const boost::system::error_code &ec);
 
 private:
 	boost::shared_ptr<boost::asio::ip::tcp::socket>	m_socket;
@@ -142,11 +141,9 @@ private:
 	boost::shared_ptr<SendBuffer>	m_sendBuffer;
 	bool							m_readyFlag;
 	bool							m_wantsLobbyMsg;
-	unsigned						m_activityTimeoutSec;
-	unsigned						m_activityWarningRemainingSec;
-	boost::asio::deadline_timer		m_initTimeoutTimer;
-	boost::asio::deadline_timer		m_globalTimeoutTimer;
-	boost::asio::deadline_timer		m_activityTimeoutTimer;
+	unsigned						m_protocolMinorVersion;
+	bool							m_compressionEnabled;
+	bool							m_fastForwardAccepted;
 	SessionDataCallback				&m_callback;
 	Gsasl_session					*m_authSession;
 	int								m_curAuthStep;
@@ -34,6 +34,7 @@
 #define _SESSIONDATACALLBACK_H_
 
 #include <boost/shared_ptr.hpp>
+#include <list>
 
 
 class NetPacket;
@@ -48,6 +49,8 @@ public:
 	virtual void SessionError(boost::shared_ptr<SessionData> session, int errorCode) = 0;
 	virtual void SessionTimeoutWarning(boost::shared_ptr<SessionData> session, unsigned remainingSec) = 0;
 	virtual void HandlePacket(boost::shared_ptr<SessionData> session, boost::shared_ptr<NetPacket> packet) = 0;
+	// Handle all packets which were received at once.
+	virtual void HandlePacketBatch(boost::shared_ptr<SessionData> session, const std::list<boost::shared_ptr<NetPacket> > &packetList) = 0;
 };
 
 #endif
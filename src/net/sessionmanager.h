@@ -34,9 +34,12 @@
 #define _SESSIONMANAGER_H_
 
 #include <boost/function.hpp>
+#include <boost/unordered_map.hpp>
 #include <map>
+#include <vector>
 
 #include <net/sessiondata.h>
+#include <net/netpacket.h>
 #include <playerdata.h>
 #include <gamedata.h>
 #include <core/thread.h>
@@ -52,6 +55,7 @@ public:
 
 	void AddSession(boost::shared_ptr<SessionData> sessionData);
 	void SetSessionPlayerData(SessionId session, boost::shared_ptr<PlayerData> playerData);
+	void SetSessionClientAddr(SessionId session, const std::string &clientAddr);
 	bool RemoveSession(SessionId session);
 
 	boost::shared_ptr<SessionData> GetSessionById(SessionId id) const;
@@ -74,19 +78,40 @@ public:
 	unsigned GetRawSessionCount() const;
 	unsigned GetSessionCountWithState(int state) const;
 	bool HasSessionWithState(int state) const;
+	bool IsFastForwardAcceptedByAll(int state) const;
 
 	void SendToAllSessions(SenderHelper &sender, boost::shared_ptr<NetPacket> packet, int state);
 	void SendLobbyMsgToAllSessions(SenderHelper &sender, boost::shared_ptr<NetPacket> packet, int state);
+	void SendLobbyMsgToAllSessions(SenderHelper &sender, const NetPacketList &packetList, int state);
 	void SendToAllButOneSessions(SenderHelper &sender, boost::shared_ptr<NetPacket> packet, SessionId except, int state);
 
 protected:
 
 	typedef std::map<SessionId, boost::shared_ptr<SessionData> > SessionMap;
+	// Immutable copy of the sessions, used to iterate without holding the lock.
+	typedef std::vector<boost::shared_ptr<SessionData> > SessionList;
+	typedef boost::shared_ptr<const SessionList> SessionListSnapshot;
+
+	SessionListSnapshot GetSnapshot() const;
+	// Secondary indices, these need to be updated whenever m_sessionMap is modified.
+	typedef boost::unordered_map<unsigned, SessionId> PlayerIdMap;
+	typedef boost::unordered_multimap<std::string, SessionId> StringIndexMap;
+
+	void InternalAddPlayerIndex(SessionId session, boost::shared_ptr<PlayerData> playerData);
+	void InternalRemovePlayerIndex(SessionId session, boost::shared_ptr<PlayerData> playerData);
+	void InternalAddClientAddrIndex(SessionId session, const std::string &clientAddr);
+	void InternalRemoveClientAddrIndex(SessionId session, const std::string &clientAddr);
+
+	static void InternalEraseIndexEntry(StringIndexMap &indexMap, const std::string &key, SessionId session);
 
 private:
 
 	SessionMap m_sessionMap;
-	mutable boost::recursive_mutex m_sessionMapMutex;
+	mutable SessionListSnapshot m_sessionSnapshot;
+	PlayerIdMap m_playerIdMap;
+	StringIndexMap m_playerNameMap; // Key is the lower case player name.
+	StringIndexMap m_clientAddrMap;
+	mutable boost::mutex m_sessionMapMutex;
 };
 
 #endif
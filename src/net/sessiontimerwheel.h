@@ -0,0 +1,121 @@
+/*****************************************************************************
+ * PokerTH - The open source texas holdem engine                             *
+ * Copyright (C) 2006-2013 Felix Hammer, Florian Thauer, Lothar May          *
+ *                                                                           *
+ * This program is free software: you can redistribute it and/or modify      *
+ * it under the terms of the GNU Affero General Public License as            *
+ * published by the Free Software Foundation, either version 3 of the        *
+ * License, or (at your option) any later version.                           *
+ *                                                                           *
+ * This program is distributed in the hope that it will be useful,           *
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of            *
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the             *
+ * GNU Affero General Public License for more details.                       *
+ *                                                                           *
+ * You should have received a copy of the GNU Affero General Public License  *
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.     *
+ *                                                                           *
+ *                                                                           *
+ * Additional permission under GNU AGPL version 3 section 7                  *
+ *                                                                           *
+ * If you modify this program, or any covered work, by linking or            *
+ * combining it with the OpenSSL project's OpenSSL library (or a             *
+ * modified version of that library), containing parts covered by the        *
+ * terms of the OpenSSL or SSLeay licenses, the authors of PokerTH           *
+ * (Felix Hammer, Florian Thauer, Lothar May) grant you additional           *
+ * permission to convey the resulting work.                                  *
+ * Corresponding Source for a non-source form of such a combination          *
+ * shall include the source code for the parts of OpenSSL used as well       *
+ * as that of the covered work.                                              *
+ *****************************************************************************/
+/* Hashed timing wheel for session timeouts. */
+
+#ifndef _SESSIONTIMERWHEEL_H_
+#define _SESSIONTIMERWHEEL_H_
+
+#include <boost/asio.hpp>
+#include <boost/thread.hpp>
+#include <boost/enable_shared_from_this.hpp>
+#include <boost/unordered_map.hpp>
+#include <list>
+#include <vector>
+
+#include <net/sessiondata.h>
+
+#define SESSION_TIMER_TICK_MSEC				1000
+#define SESSION_TIMER_NUM_SLOTS				512
+
+// All session timeouts are handled by a single asio timer. Starting,
+// resetting and cancelling a timeout is O(1).
+class SessionTimerWheel : public boost::enable_shared_from_this<SessionTimerWheel>
+{
+public:
+	SessionTimerWheel(boost::shared_ptr<boost::asio::io_service> ioService, SessionDataCallback &callback);
+	virtual ~SessionTimerWheel();
+
+	void Start();
+	void Stop();
+
+	void StartInitTimeout(boost::shared_ptr<SessionData> session, unsigned timeoutSec);
+	void StartGlobalTimeout(boost::shared_ptr<SessionData> session, unsigned timeoutSec);
+	void StartActivityTimeout(boost::shared_ptr<SessionData> session, unsigned timeoutSec, unsigned warningRemainingSec);
+	void ResetActivityTimeout(SessionId session);
+	void CancelTimeouts(SessionId session);
+
+protected:
+
+	// Each session has up to one pending timeout per slot type.
+	enum SlotType { SLOT_INIT = 0, SLOT_GLOBAL, SLOT_ACTIVITY, NUM_SLOT_TYPES };
+	enum TimeoutType { TIMEOUT_INIT, TIMEOUT_GLOBAL, TIMEOUT_ACTIVITY_WARNING, TIMEOUT_ACTIVITY };
+
+	struct WheelEntry {
+		SessionId sessionId;
+		TimeoutType type;
+		unsigned rounds;
+	};
+	typedef std::list<WheelEntry> WheelSlot;
+
+	struct SessionTimeouts {
+		SessionTimeouts() : activityTimeoutSec(0), activityWarningRemainingSec(0) {
+			for (int i = 0; i < NUM_SLOT_TYPES; i++) {
+				active[i] = false;
+				slot[i] = 0;
+			}
+		}
+		boost::weak_ptr<SessionData> session;
+		unsigned activityTimeoutSec;
+		unsigned activityWarningRemainingSec;
+		bool active[NUM_SLOT_TYPES];
+		unsigned slot[NUM_SLOT_TYPES];
+		WheelSlot::iterator pos[NUM_SLOT_TYPES];
+	};
+	typedef boost::unordered_map<SessionId, SessionTimeouts> SessionTimeoutMap;
+
+	struct ExpiredTimeout {
+		boost::weak_ptr<SessionData> session;
+		TimeoutType type;
+		unsigned remainingSec;
+	};
+	typedef std::list<ExpiredTimeout> ExpiredList;
+
+	SessionTimeouts &InternalGetSessionTimeouts(boost::shared_ptr<SessionData> session);
+	void InternalSchedule(SessionTimeouts &timeouts, SessionId sessionId, TimeoutType type, unsigned timeoutSec);
+	void InternalUnschedule(SessionTimeouts &timeouts, SlotType slotType);
+	void InternalHandleExpired(const ExpiredTimeout &expired);
+
+	static SlotType GetSlotType(TimeoutType type);
+
+	void TimerTick(const boost::system::error_code &ec);
+
+private:
+	boost::shared_ptr<boost::asio::io_service> m_ioService;
+	boost::asio::deadline_timer m_tickTimer;
+	SessionDataCallback &m_callback;
+
+	std::vector<WheelSlot> m_wheel;
+	unsigned m_curSlot;
+	SessionTimeoutMap m_sessionTimeouts;
+	mutable boost::mutex m_wheelMutex;
+};
+
+#endif
@@ -0,0 +1,90 @@
+/*****************************************************************************
+ * PokerTH - The open source texas holdem engine                             *
+ * Copyright (C) 2006-2013 Felix Hammer, Florian Thauer, Lothar May          *
+ *                                                                           *
+ * This program is free software: you can redistribute it and/or modify      *
+ * it under the terms of the GNU Affero General Public License as            *
+ * published by the Free Software Foundation, either version 3 of the        *
+ * License, or (at your option) any later version.                           *
+ *                                                                           *
+ * This program is distributed in the hope that it will be useful,           *
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of            *
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the             *
+ * GNU Affero General Public License for more details.                       *
+ *                                                                           *
+ * You should have received a copy of the GNU Affero General Public License  *
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.     *
+ *                                                                           *
+ *                                                                           *
+ * Additional permission under GNU AGPL version 3 section 7                  *
+ *                                                                           *
+ * If you modify this program, or any covered work, by linking or            *
+ * combining it with the OpenSSL project's OpenSSL library (or a             *
+ * modified version of that library), containing parts covered by the        *
+ * terms of the OpenSSL or SSLeay licenses, the authors of PokerTH           *
+ * (Felix Hammer, Florian Thauer, Lothar May) grant you additional           *
+ * permission to convey the resulting work.                                  *
+ * Corresponding Source for a non-source form of such a combination          *
+ * shall include the source code for the parts of OpenSSL used as well       *
+ * as that of the covered work.                                              *
+ *****************************************************************************/
+/* Delayed packet feed for the spectators of a game. */
+
+#ifndef _SPECTATORFEED_H_
+#define _SPECTATORFEED_H_
+
+#include <boost/cstdint.hpp>
+#include <third_party/boost/timers.hpp>
+#include <deque>
+#include <set>
+
+#include <net/netpacket.h>
+#include <net/sessiondata.h>
+
+class SessionManager;
+class SenderHelper;
+
+// Packets for spectators are queued and sent to all spectators at once,
+// after an optional delay. Each flush is compressed only once.
+class SpectatorFeed
+{
+public:
+	SpectatorFeed(unsigned delaySec);
+	virtual ~SpectatorFeed();
+
+	unsigned GetDelayMsec() const;
+
+	// Returns true if the feed was empty, i.e. a flush needs to be scheduled.
+	bool Push(boost::shared_ptr<NetPacket> packet);
+	// Spectators only receive packets which were pushed after they were added.
+	// The initial packet is sent to the new spectator with the same delay.
+	// Returns true if a flush needs to be scheduled.
+	bool AddSpectator(SessionId session, boost::shared_ptr<NetPacket> initialPacket = boost::shared_ptr<NetPacket>());
+	void RemoveSpectator(SessionId session);
+	void Clear();
+
+	// Sends the packets which are due. Returns the number of milliseconds
+	// until the next packet is due, or 0 if the feed is empty.
+	unsigned Flush(SessionManager &sessionManager, SenderHelper &sender);
+
+protected:
+	struct FeedEntry {
+		boost::uint64_t dueMsec;
+		// Either a packet for all spectators, or a new spectator with
+		// its initial packet.
+		boost::shared_ptr<NetPacket> packet;
+		SessionId newSpectator;
+	};
+	typedef std::deque<FeedEntry> FeedEntryList;
+	typedef std::set<SessionId> SpectatorSet;
+
+	void InternalSend(SessionManager &sessionManager, SenderHelper &sender, const NetPacketList &packetList);
+
+private:
+	const unsigned m_delayMsec;
+	FeedEntryList m_entries;
+	SpectatorSet m_spectators;
+	boost::timers::portable::microsec_timer m_clock;
+};
+
+#endif
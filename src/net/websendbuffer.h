@@ -44,12 +44,14 @@ public:
 	virtual void SetCloseAfterSend();
 
 	virtual void AsyncSendNextPacket(boost::shared_ptr<SessionData> session);
-	virtual void InternalStorePacket(boost::shared_ptr<SessionData> session, boost::shared_ptr<NetPacket> packet);
+	virtual StoreResult InternalStorePacket(boost::shared_ptr<SessionData> session, boost::shared_ptr<NetPacket> packet);
+	virtual bool IsCongested(boost::shared_ptr<SessionData> session) const;
 
 	virtual void HandleWrite(boost::shared_ptr<boost::asio::ip::tcp::socket> socket, const boost::system::error_code &error);
 
 private:
 	bool closeAfterSend;
+	bool overflow;
 };
 
 #endif
@@ -51,13 +51,17 @@ struct ServerInfo {
 struct ServerStats {
 	ServerStats()
 		: numberOfPlayersOnServer(0), numberOfGamesOpen(0), totalPlayersEverLoggedIn(0),
-		  totalGamesEverCreated(0), maxGamesOpen(0), maxPlayersLoggedIn(0) {}
+		  totalGamesEverCreated(0), maxGamesOpen(0), maxPlayersLoggedIn(0),
+		  numberOfDroppedPackets(0), numberOfEvictedSessions(0), compressionSavedKBytes(0) {}
 	unsigned numberOfPlayersOnServer;
 	unsigned numberOfGamesOpen;
 	unsigned totalPlayersEverLoggedIn;
 	unsigned totalGamesEverCreated;
 	unsigned maxGamesOpen;
 	unsigned maxPlayersLoggedIn;
+	unsigned numberOfDroppedPackets;
+	unsigned numberOfEvictedSessions;
+	unsigned compressionSavedKBytes;
 };
 
 
@@ -1,18 +1,372 @@
+/* Benchmark for parsing and building network packets.
+ *
+ * Usage: pokerth_tests [trace file] [iterations]
+ *
+ * The trace file contains packets as they are sent over TCP, i.e. each
+ * packet is prefixed by its size (4 bytes, network byte order). Such a
+ * trace can be captured from a server connection e.g. with tcpflow. If no
+ * trace file is given, a synthetic trace of typical game packets is used.
+ *
+ * Packets are parsed and built once with recycled messages (NetPacket) and
+ * once with a new message per packet, for comparison.
+ *
+ * Afterwards, the session manager is benchmarked: several threads broadcast
+ * to all sessions (ForEach) while other threads add and remove sessions, as
+ * happens when players join and leave the server.
+ */
+
+#include <boost/asio.hpp>
 #include <boost/shared_ptr.hpp>
+#include <boost/bind.hpp>
+#include <boost/thread.hpp>
+#include <third_party/boost/timers.hpp>
 #include <net/netpacket.h>
+#include <net/sessionmanager.h>
+#include <net/sessiondatacallback.h>
 #include <game_defs.h>
+#include <fstream>
+#include <iostream>
+#include <cstdlib>
+#include <cstring>
+#include <vector>
+#include <string>
+
+using namespace std;
+
+typedef vector<string> PacketTrace;
+typedef vector<boost::shared_ptr<SessionData> > SessionVector;
+
+#define CONTENTION_NUM_SESSIONS			500
+#define CONTENTION_SESSIONS_PER_WRITER	10
+
+static void
+AddToTrace(PacketTrace &trace, const NetPacket &packet)
+{
+	string data;
+	packet.GetMsg()->SerializeToString(&data);
+	trace.push_back(data);
+}
+
+static void
+CreateSyntheticTrace(PacketTrace &trace)
+{
+	NetPacket announce;
+	announce.GetMsg()->set_messagetype(PokerTHMessage::Type_AnnounceMessage);
+	AnnounceMessage *netAnnounce = announce.GetMsg()->mutable_announcemessage();
+	netAnnounce->mutable_protocolversion()->set_majorversion(NET_VERSION_MAJOR);
+	netAnnounce->mutable_protocolversion()->set_minorversion(NET_VERSION_MINOR);
+	netAnnounce->mutable_latestgameversion()->set_majorversion(POKERTH_VERSION_MAJOR);
+	netAnnounce->mutable_latestgameversion()->set_minorversion(POKERTH_VERSION_MINOR);
+	netAnnounce->set_latestbetarevision(POKERTH_BETA_REVISION);
+	netAnnounce->set_servertype(AnnounceMessage::serverTypeInternetAuth);
+	netAnnounce->set_numplayersonserver(100);
+	AddToTrace(trace, announce);
+
+	for (unsigned player = 1; player <= 10; player++) {
+		NetPacket info;
+		info.GetMsg()->set_messagetype(PokerTHMessage::Type_PlayerInfoReplyMessage);
+		PlayerInfoReplyMessage *netInfo = info.GetMsg()->mutable_playerinforeplymessage();
+		netInfo->set_playerid(player);
+		PlayerInfoReplyMessage::PlayerInfoData *data = netInfo->mutable_playerinfodata();
+		data->set_playername("Player" + string(1, static_cast<char>('A' + player)));
+		data->set_ishuman(true);
+		data->set_playerrights(netPlayerRightsNormal);
+		data->set_countrycode("DE");
+		data->mutable_avatardata()->set_avatartype(netAvatarImagePng);
+		data->mutable_avatardata()->set_avatarhash(string(16, static_cast<char>(player)));
+		AddToTrace(trace, info);
+	}
+
+	// One hand with ten players.
+	NetPacket handStart;
+	handStart.GetMsg()->set_messagetype(PokerTHMessage::Type_HandStartMessage);
+	HandStartMessage *netHandStart = handStart.GetMsg()->mutable_handstartmessage();
+	netHandStart->set_gameid(1);
+	netHandStart->mutable_plaincards()->set_plaincard1(12);
+	netHandStart->mutable_plaincards()->set_plaincard2(25);
+	netHandStart->set_smallblind(50);
+	for (unsigned player = 1; player <= 10; player++) {
+		netHandStart->add_seatstates(netPlayerStateNormal);
+	}
+	netHandStart->set_dealerplayerid(1);
+	AddToTrace(trace, handStart);
+
+	for (int round = netStatePreflop; round <= netStateRiver; round++) {
+		for (unsigned player = 1; player <= 10; player++) {
+			NetPacket turn;
+			turn.GetMsg()->set_messagetype(PokerTHMessage::Type_PlayersTurnMessage);
+			PlayersTurnMessage *netTurn = turn.GetMsg()->mutable_playersturnmessage();
+			netTurn->set_gameid(1);
+			netTurn->set_playerid(player);
+			netTurn->set_gamestate(static_cast<NetGameState>(round));
+			AddToTrace(trace, turn);
+
+			NetPacket action;
+			action.GetMsg()->set_messagetype(PokerTHMessage::Type_PlayersActionDoneMessage);
+			PlayersActionDoneMessage *netAction = action.GetMsg()->mutable_playersactiondonemessage();
+			netAction->set_gameid(1);
+			netAction->set_playerid(player);
+			netAction->set_gamestate(static_cast<NetGameState>(round));
+			netAction->set_playeraction(netActionCall);
+			netAction->set_totalplayerbet(100);
+			netAction->set_playermoney(4900);
+			netAction->set_highestset(100);
+			netAction->set_minimumraise(100);
+			AddToTrace(trace, action);
+		}
+		if (round == netStatePreflop) {
+			NetPacket flop;
+			flop.GetMsg()->set_messagetype(PokerTHMessage::Type_DealFlopCardsMessage);
+			DealFlopCardsMessage *netFlop = flop.GetMsg()->mutable_dealflopcardsmessage();
+			netFlop->set_gameid(1);
+			netFlop->set_flopcard1(3);
+			netFlop->set_flopcard2(17);
+			netFlop->set_flopcard3(40);
+			AddToTrace(trace, flop);
+		}
+	}
+
+	NetPacket chat;
+	chat.GetMsg()->set_messagetype(PokerTHMessage::Type_ChatMessage);
+	ChatMessage *netChat = chat.GetMsg()->mutable_chatmessage();
+	netChat->set_gameid(1);
+	netChat->set_playerid(3);
+	netChat->set_chattype(ChatMessage::chatTypeGame);
+	netChat->set_chattext("nice hand");
+	AddToTrace(trace, chat);
+}
+
+static bool
+ReadTrace(const char *fileName, PacketTrace &trace)
+{
+	ifstream in(fileName, ios::in | ios::binary);
+	if (!in) {
+		return false;
+	}
+	char header[NET_HEADER_SIZE];
+	while (in.read(header, NET_HEADER_SIZE)) {
+		uint32_t nativeVal;
+		memcpy(&nativeVal, header, sizeof(uint32_t));
+		size_t packetSize = ntohl(nativeVal);
+		if (packetSize > MAX_COMPRESSED_PACKET_SIZE) {
+			cerr << "Invalid packet size in trace: " << packetSize << endl;
+			return false;
+		}
+		string data(packetSize, '\0');
+		if (packetSize && !in.read(&data[0], packetSize)) {
+			break;
+		}
+		trace.push_back(data);
+	}
+	return !trace.empty();
+}
+
+static void
+RunBenchmark(const PacketTrace &trace, unsigned iterations, bool recycle)
+{
+	size_t numPackets = 0;
+	size_t numBytes = 0;
+	string outData;
+	boost::timers::portable::microsec_timer timer;
+	for (unsigned i = 0; i < iterations; i++) {
+		PacketTrace::const_iterator pos = trace.begin();
+		PacketTrace::const_iterator end = trace.end();
+		while (pos != end) {
+			// Parse the packet, and build it again as the server would.
+			if (recycle) {
+				boost::shared_ptr<NetPacket> packet(NetPacket::Create(pos->data(), pos->size()));
+				if (packet) {
+					NetPacket outPacket;
+					outPacket.GetMsg()->CopyFrom(*packet->GetMsg());
+					outPacket.GetMsg()->SerializeToString(&outData);
+					numPackets++;
+				}
+			} else {
+				PokerTHMessage *msg = PokerTHMessage::default_instance().New();
+				if (msg->ParseFromArray(pos->data(), static_cast<int>(pos->size()))) {
+					PokerTHMessage *outMsg = PokerTHMessage::default_instance().New();
+					outMsg->CopyFrom(*msg);
+					outMsg->SerializeToString(&outData);
+					delete outMsg;
+					numPackets++;
+				}
+				delete msg;
+			}
+			numBytes += pos->size();
+			++pos;
+		}
+	}
+	double sec = static_cast<double>(timer.elapsed().total_microseconds()) / 1e6;
+	cout << (recycle ? "Recycled messages: " : "New messages:      ")
+		 << numPackets << " packets, " << numBytes / 1024 << " KB in " << sec << " s, "
+		 << (sec > 0 ? static_cast<unsigned>(numPackets / sec) : 0) << " packets/s" << endl;
+}
+
+class BenchmarkSessionCallback : public SessionDataCallback
+{
+public:
+	virtual void CloseSession(boost::shared_ptr<SessionData> /*session*/) {}
+	virtual void SessionError(boost::shared_ptr<SessionData> /*session*/, int /*errorCode*/) {}
+	virtual void SessionTimeoutWarning(boost::shared_ptr<SessionData> /*session*/, unsigned /*remainingSec*/) {}
+	virtual void HandlePacket(boost::shared_ptr<SessionData> /*session*/, boost::shared_ptr<NetPacket> /*packet*/) {}
+	virtual void HandlePacketBatch(boost::shared_ptr<SessionData> /*session*/, const std::list<boost::shared_ptr<NetPacket> > &/*packetList*/) {}
+};
+
+struct ContentionResult {
+	ContentionResult() : numOps(0), sec(0) {}
+	size_t numOps;
+	double sec;
+};
+
+class StopFlag
+{
+public:
+	StopFlag() : m_stop(false) {}
+
+	void Set()
+	{
+		boost::mutex::scoped_lock lock(m_mutex);
+		m_stop = true;
+	}
+	bool IsSet() const
+	{
+		boost::mutex::scoped_lock lock(m_mutex);
+		return m_stop;
+	}
+
+private:
+	mutable boost::mutex m_mutex;
+	bool m_stop;
+};
+
+static void
+CountGameSession(boost::shared_ptr<SessionData> session, size_t *counter)
+{
+	// Same check as for sending a packet to all sessions with a certain state.
+	if ((session->GetState() & SessionData::Game) != 0)
+		(*counter)++;
+}
+
+static void
+BroadcastLoop(SessionManager *manager, unsigned iterations, ContentionResult *result)
+{
+	size_t counter = 0;
+	boost::timers::portable::microsec_timer timer;
+	for (unsigned i = 0; i < iterations; i++) {
+		manager->ForEach(boost::bind(&CountGameSession, _1, &counter));
+	}
+	result->sec = static_cast<double>(timer.elapsed().total_microseconds()) / 1e6;
+	result->numOps = iterations;
+}
+
+static void
+JoinLeaveLoop(SessionManager *manager, const SessionVector *sessions, const StopFlag *stop, ContentionResult *result)
+{
+	size_t iterations = 0;
+	boost::timers::portable::microsec_timer timer;
+	// Keep joining and leaving as long as the broadcasts are running.
+	while (!stop->IsSet()) {
+		SessionVector::const_iterator pos = sessions->begin();
+		SessionVector::const_iterator end = sessions->end();
+		while (pos != end) {
+			manager->AddSession(*pos);
+			++pos;
+		}
+		pos = sessions->begin();
+		while (pos != end) {
+			manager->RemoveSession((*pos)->GetId());
+			++pos;
+		}
+		iterations++;
+	}
+	result->sec = static_cast<double>(timer.elapsed().total_microseconds()) / 1e6;
+	result->numOps = iterations * sessions->size();
+}
+
+static void
+PrintContentionResult(const char *name, const vector<ContentionResult> &results)
+{
+	// The threads run in parallel, so the slowest one determines the time.
+	size_t numOps = 0;
+	double sec = 0;
+	vector<ContentionResult>::const_iterator pos = results.begin();
+	vector<ContentionResult>::const_iterator end = results.end();
+	while (pos != end) {
+		numOps += pos->numOps;
+		if (pos->sec > sec)
+			sec = pos->sec;
+		++pos;
+	}
+	cout << name << numOps << " in " << sec << " s, "
+		 << (sec > 0 ? static_cast<unsigned>(numOps / sec) : 0) << "/s" << endl;
+}
+
+static void
+RunContentionBenchmark(unsigned numBroadcasters, unsigned numWriters, unsigned iterations)
+{
+	boost::asio::io_service ioService;
+	BenchmarkSessionCallback callback;
+	SessionManager manager;
+	SessionId curId = INVALID_SESSION + 1;
+
+	for (unsigned i = 0; i < CONTENTION_NUM_SESSIONS; i++) {
+		boost::shared_ptr<boost::asio::ip::tcp::socket> sock(new boost::asio::ip::tcp::socket(ioService));
+		boost::shared_ptr<SessionData> session(new SessionData(sock, curId++, callback, MAX_PACKET_SIZE));
+		session->SetState(SessionData::Game);
+		manager.AddSession(session);
+	}
+	vector<SessionVector> writerSessions(numWriters);
+	for (unsigned i = 0; i < numWriters; i++) {
+		for (unsigned j = 0; j < CONTENTION_SESSIONS_PER_WRITER; j++) {
+			boost::shared_ptr<boost::asio::ip::tcp::socket> sock(new boost::asio::ip::tcp::socket(ioService));
+			writerSessions[i].push_back(boost::shared_ptr<SessionData>(new SessionData(sock, curId++, callback, MAX_PACKET_SIZE)));
+		}
+	}
+
+	vector<ContentionResult> broadcastResults(numBroadcasters);
+	vector<ContentionResult> joinLeaveResults(numWriters);
+	StopFlag stop;
+	boost::thread_group writers;
+	for (unsigned i = 0; i < numWriters; i++) {
+		writers.create_thread(boost::bind(&JoinLeaveLoop, &manager, &writerSessions[i], &stop, &joinLeaveResults[i]));
+	}
+	boost::thread_group broadcasters;
+	for (unsigned i = 0; i < numBroadcasters; i++) {
+		broadcasters.create_thread(boost::bind(&BroadcastLoop, &manager, iterations, &broadcastResults[i]));
+	}
+	broadcasters.join_all();
+	stop.Set();
+	writers.join_all();
+
+	cout << numBroadcasters << " broadcast threads, " << numWriters << " join/leave threads, "
+		 << CONTENTION_NUM_SESSIONS << " sessions:" << endl;
+	PrintContentionResult("  Broadcasts:  ", broadcastResults);
+	if (numWriters)
+		PrintContentionResult("  Join/leave:  ", joinLeaveResults);
+}
 
 int
-main()
+main(int argc, char *argv[])
 {
-	boost::shared_ptr<NetPacket> packet(new NetPacket(NetPacket::Alloc));
-	packet->GetMsg()->present = PokerTHMessage_PR_announceMessage;
-	AnnounceMessage_t *netAnnounce = &packet->GetMsg()->choice.announceMessage;
-	netAnnounce->protocolVersion.major = NET_VERSION_MAJOR;
-	netAnnounce->protocolVersion.minor = NET_VERSION_MINOR;
-	netAnnounce->latestGameVersion.major = POKERTH_VERSION_MAJOR;
-	netAnnounce->latestGameVersion.minor = POKERTH_VERSION_MINOR;
-	netAnnounce->latestBetaRevision = POKERTH_BETA_REVISION;
+	PacketTrace trace;
+	if (argc > 1) {
+		if (!ReadTrace(argv[1], trace)) {
+			cerr << "Unable to read packet trace " << argv[1] << endl;
+			return 1;
+		}
+	} else {
+		CreateSyntheticTrace(trace);
+	}
+	unsigned iterations = argc > 2 ? static_cast<unsigned>(atoi(argv[2])) : 10000;
+
+	// Warm up the message pool first.
+	RunBenchmark(trace, 1, true);
+	RunBenchmark(trace, iterations, false);
+	RunBenchmark(trace, iterations, true);
 
+	unsigned sessionIterations = iterations / 5;
+	RunContentionBenchmark(1, 0, sessionIterations);
+	RunContentionBenchmark(4, 0, sessionIterations);
+	RunContentionBenchmark(4, 2, sessionIterations);
 	return 0;
 }
@@ -29,6 +29,7 @@ void protobuf_ShutdownFile_pokerth_2eproto() {
   delete UnknownAvatarMessage::default_instance_;
   delete PlayerListMessage::default_instance_;
   delete GameListNewMessage::default_instance_;
+  delete LobbySnapshotMessage::default_instance_;
   delete GameListUpdateMessage::default_instance_;
   delete GameListPlayerJoinedMessage::default_instance_;
   delete GameListPlayerLeftMessage::default_instance_;
@@ -103,6 +104,7 @@ void protobuf_ShutdownFile_pokerth_2eproto() {
   delete AdminRemoveGameAckMessage::default_instance_;
   delete AdminBanPlayerMessage::default_instance_;
   delete AdminBanPlayerAckMessage::default_instance_;
+  delete CompressedPacketsMessage::default_instance_;
   delete PokerTHMessage::default_instance_;
 }
 
@@ -134,6 +136,7 @@ void protobuf_AddDesc_pokerth_2eproto() {
   UnknownAvatarMessage::default_instance_ = new UnknownAvatarMessage();
   PlayerListMessage::default_instance_ = new PlayerListMessage();
   GameListNewMessage::default_instance_ = new GameListNewMessage();
+  LobbySnapshotMessage::default_instance_ = new LobbySnapshotMessage();
   GameListUpdateMessage::default_instance_ = new GameListUpdateMessage();
   GameListPlayerJoinedMessage::default_instance_ = new GameListPlayerJoinedMessage();
   GameListPlayerLeftMessage::default_instance_ = new GameListPlayerLeftMessage();
@@ -208,6 +211,7 @@ void protobuf_AddDesc_pokerth_2eproto() {
   AdminRemoveGameAckMessage::default_instance_ = new AdminRemoveGameAckMessage();
   AdminBanPlayerMessage::default_instance_ = new AdminBanPlayerMessage();
   AdminBanPlayerAckMessage::default_instance_ = new AdminBanPlayerAckMessage();
+  CompressedPacketsMessage::default_instance_ = new CompressedPacketsMessage();
   PokerTHMessage::default_instance_ = new PokerTHMessage();
   NetGameInfo::default_instance_->InitAsDefaultInstance();
   PlayerResult::default_instance_->InitAsDefaultInstance();
@@ -225,6 +229,7 @@ void protobuf_AddDesc_pokerth_2eproto() {
   UnknownAvatarMessage::default_instance_->InitAsDefaultInstance();
   PlayerListMessage::default_instance_->InitAsDefaultInstance();
   GameListNewMessage::default_instance_->InitAsDefaultInstance();
+  LobbySnapshotMessage::default_instance_->InitAsDefaultInstance();
   GameListUpdateMessage::default_instance_->InitAsDefaultInstance();
   GameListPlayerJoinedMessage::default_instance_->InitAsDefaultInstance();
   GameListPlayerLeftMessage::default_instance_->InitAsDefaultInstance();
@@ -299,6 +304,7 @@ void protobuf_AddDesc_pokerth_2eproto() {
   AdminRemoveGameAckMessage::default_instance_->InitAsDefaultInstance();
   AdminBanPlayerMessage::default_instance_->InitAsDefaultInstance();
   AdminBanPlayerAckMessage::default_instance_->InitAsDefaultInstance();
+  CompressedPacketsMessage::default_instance_->InitAsDefaultInstance();
   PokerTHMessage::default_instance_->InitAsDefaultInstance();
   ::google::protobuf::internal::OnShutdown(&protobuf_ShutdownFile_pokerth_2eproto);
 }
@@ -2122,6 +2128,8 @@ const int InitMessage::kLoginFieldNumber;
 const int InitMessage::kNickNameFieldNumber;
 const int InitMessage::kClientUserDataFieldNumber;
 const int InitMessage::kAvatarHashFieldNumber;
+const int InitMessage::kSupportsCompressionFieldNumber;
+const int InitMessage::kAcceptsFastForwardFieldNumber;
 #endif  // !_MSC_VER
 
 InitMessage::InitMessage()
@@ -2154,6 +2162,8 @@ void InitMessage::SharedCtor() {
   nickname_ = const_cast< ::std::string*>(&::google::protobuf::internal::kEmptyString);
   clientuserdata_ = const_cast< ::std::string*>(&::google::protobuf::internal::kEmptyString);
   avatarhash_ = const_cast< ::std::string*>(&::google::protobuf::internal::kEmptyString);
+  supportscompression_ = false;
+  acceptsfastforward_ = false;
   ::memset(_has_bits_, 0, sizeof(_has_bits_));
 }
 
@@ -2239,6 +2249,10 @@ void InitMessage::Clear() {
       }
     }
   }
+  if (_has_bits_[8 / 32] & (0xffu << (8 % 32))) {
+    supportscompression_ = false;
+    acceptsfastforward_ = false;
+  }
   ::memset(_has_bits_, 0, sizeof(_has_bits_));
 }
 
@@ -2362,6 +2376,38 @@ bool InitMessage::MergePartialFromCodedStream(
         } else {
           goto handle_uninterpreted;
         }
+        if (input->ExpectTag(72)) goto parse_supportsCompression;
+        break;
+      }
+
+      // optional bool supportsCompression = 9;
+      case 9: {
+        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
+            ::google::protobuf::internal::WireFormatLite::WIRETYPE_VARINT) {
+         parse_supportsCompression:
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   bool, ::google::protobuf::internal::WireFormatLite::TYPE_BOOL>(
+                 input, &supportscompression_)));
+          set_has_supportscompression();
+        } else {
+          goto handle_uninterpreted;
+        }
+        if (input->ExpectTag(80)) goto parse_acceptsFastForward;
+        break;
+      }
+
+      // optional bool acceptsFastForward = 10;
+      case 10: {
+        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
+            ::google::protobuf::internal::WireFormatLite::WIRETYPE_VARINT) {
+         parse_acceptsFastForward:
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   bool, ::google::protobuf::internal::WireFormatLite::TYPE_BOOL>(
+                 input, &acceptsfastforward_)));
+          set_has_acceptsfastforward();
+        } else {
+          goto handle_uninterpreted;
+        }
         if (input->ExpectAtEnd()) return true;
         break;
       }
@@ -2430,6 +2476,16 @@ void InitMessage::SerializeWithCachedSizes(
       8, this->avatarhash(), output);
   }
 
+  // optional bool supportsCompression = 9;
+  if (has_supportscompression()) {
+    ::google::protobuf::internal::WireFormatLite::WriteBool(9, this->supportscompression(), output);
+  }
+
+  // optional bool acceptsFastForward = 10;
+  if (has_acceptsfastforward()) {
+    ::google::protobuf::internal::WireFormatLite::WriteBool(10, this->acceptsfastforward(), output);
+  }
+
 }
 
 int InitMessage::ByteSize() const {
@@ -2491,6 +2547,18 @@ int InitMessage::ByteSize() const {
           this->avatarhash());
     }
 
+  }
+  if (_has_bits_[8 / 32] & (0xffu << (8 % 32))) {
+    // optional bool supportsCompression = 9;
+    if (has_supportscompression()) {
+      total_size += 1 + 1;
+    }
+
+    // optional bool acceptsFastForward = 10;
+    if (has_acceptsfastforward()) {
+      total_size += 1 + 1;
+    }
+
   }
   GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
   _cached_size_ = total_size;
@@ -2531,6 +2599,14 @@ void InitMessage::MergeFrom(const InitMessage& from) {
       set_avatarhash(from.avatarhash());
     }
   }
+  if (from._has_bits_[8 / 32] & (0xffu << (8 % 32))) {
+    if (from.has_supportscompression()) {
+      set_supportscompression(from.supportscompression());
+    }
+    if (from.has_acceptsfastforward()) {
+      set_acceptsfastforward(from.acceptsfastforward());
+    }
+  }
 }
 
 void InitMessage::CopyFrom(const InitMessage& from) {
@@ -2558,6 +2634,8 @@ void InitMessage::Swap(InitMessage* other) {
     std::swap(nickname_, other->nickname_);
     std::swap(clientuserdata_, other->clientuserdata_);
     std::swap(avatarhash_, other->avatarhash_);
+    std::swap(supportscompression_, other->supportscompression_);
+    std::swap(acceptsfastforward_, other->acceptsfastforward_);
     std::swap(_has_bits_[0], other->_has_bits_[0]);
     std::swap(_cached_size_, other->_cached_size_);
   }
@@ -5017,6 +5095,220 @@ void GameListNewMessage::Swap(GameListNewMessage* other) {
 }
 
 
+// ===================================================================
+
+#ifndef _MSC_VER
+const int LobbySnapshotMessage::kPlayerIdsFieldNumber;
+const int LobbySnapshotMessage::kGamesFieldNumber;
+#endif  // !_MSC_VER
+
+LobbySnapshotMessage::LobbySnapshotMessage()
+  : ::google::protobuf::MessageLite() {
+  SharedCtor();
+}
+
+void LobbySnapshotMessage::InitAsDefaultInstance() {
+}
+
+LobbySnapshotMessage::LobbySnapshotMessage(const LobbySnapshotMessage& from)
+  : ::google::protobuf::MessageLite() {
+  SharedCtor();
+  MergeFrom(from);
+}
+
+void LobbySnapshotMessage::SharedCtor() {
+  _cached_size_ = 0;
+  ::memset(_has_bits_, 0, sizeof(_has_bits_));
+}
+
+LobbySnapshotMessage::~LobbySnapshotMessage() {
+  SharedDtor();
+}
+
+void LobbySnapshotMessage::SharedDtor() {
+  #ifdef GOOGLE_PROTOBUF_NO_STATIC_INITIALIZER
+  if (this != &default_instance()) {
+  #else
+  if (this != default_instance_) {
+  #endif
+  }
+}
+
+void LobbySnapshotMessage::SetCachedSize(int size) const {
+  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
+  _cached_size_ = size;
+  GOOGLE_SAFE_CONCURRENT_WRITES_END();
+}
+const LobbySnapshotMessage& LobbySnapshotMessage::default_instance() {
+#ifdef GOOGLE_PROTOBUF_NO_STATIC_INITIALIZER
+  protobuf_AddDesc_pokerth_2eproto();
+#else
+  if (default_instance_ == NULL) protobuf_AddDesc_pokerth_2eproto();
+#endif
+  return *default_instance_;
+}
+
+LobbySnapshotMessage* LobbySnapshotMessage::default_instance_ = NULL;
+
+LobbySnapshotMessage* LobbySnapshotMessage::New() const {
+  return new LobbySnapshotMessage;
+}
+
+void LobbySnapshotMessage::Clear() {
+  playerids_.Clear();
+  games_.Clear();
+  ::memset(_has_bits_, 0, sizeof(_has_bits_));
+}
+
+bool LobbySnapshotMessage::MergePartialFromCodedStream(
+    ::google::protobuf::io::CodedInputStream* input) {
+#define DO_(EXPRESSION) if (!(EXPRESSION)) return false
+  ::google::protobuf::uint32 tag;
+  while ((tag = input->ReadTag()) != 0) {
+    switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
+      // repeated uint32 playerIds = 1 [packed = true];
+      case 1: {
+        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
+            ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED) {
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPackedPrimitive<
+                   ::google::protobuf::uint32, ::google::protobuf::internal::WireFormatLite::TYPE_UINT32>(
+                 input, this->mutable_playerids())));
+        } else if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag)
+                   == ::google::protobuf::internal::WireFormatLite::
+                      WIRETYPE_VARINT) {
+          DO_((::google::protobuf::internal::WireFormatLite::ReadRepeatedPrimitiveNoInline<
+                   ::google::protobuf::uint32, ::google::protobuf::internal::WireFormatLite::TYPE_UINT32>(
+                 1, 10, input, this->mutable_playerids())));
+        } else {
+          goto handle_uninterpreted;
+        }
+        if (input->ExpectTag(18)) goto parse_games;
+        break;
+      }
+
+      // repeated .GameListNewMessage games = 2;
+      case 2: {
+        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
+            ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED) {
+         parse_games:
+          DO_(::google::protobuf::internal::WireFormatLite::ReadMessageNoVirtual(
+                input, add_games()));
+        } else {
+          goto handle_uninterpreted;
+        }
+        if (input->ExpectTag(18)) goto parse_games;
+        if (input->ExpectAtEnd()) return true;
+        break;
+      }
+
+      default: {
+      handle_uninterpreted:
+        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
+            ::google::protobuf::internal::WireFormatLite::WIRETYPE_END_GROUP) {
+          return true;
+        }
+        DO_(::google::protobuf::internal::WireFormatLite::SkipField(input, tag));
+        break;
+      }
+    }
+  }
+  return true;
+#undef DO_
+}
+
+void LobbySnapshotMessage::SerializeWithCachedSizes(
+    ::google::protobuf::io::CodedOutputStream* output) const {
+  // repeated uint32 playerIds = 1 [packed = true];
+  if (this->playerids_size() > 0) {
+    ::google::protobuf::internal::WireFormatLite::WriteTag(1, ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED, output);
+    output->WriteVarint32(_playerids_cached_byte_size_);
+  }
+  for (int i = 0; i < this->playerids_size(); i++) {
+    ::google::protobuf::internal::WireFormatLite::WriteUInt32NoTag(
+      this->playerids(i), output);
+  }
+
+  // repeated .GameListNewMessage games = 2;
+  for (int i = 0; i < this->games_size(); i++) {
+    ::google::protobuf::internal::WireFormatLite::WriteMessage(
+      2, this->games(i), output);
+  }
+
+}
+
+int LobbySnapshotMessage::ByteSize() const {
+  int total_size = 0;
+
+  // repeated uint32 playerIds = 1 [packed = true];
+  {
+    int data_size = 0;
+    for (int i = 0; i < this->playerids_size(); i++) {
+      data_size += ::google::protobuf::internal::WireFormatLite::
+        UInt32Size(this->playerids(i));
+    }
+    if (data_size > 0) {
+      total_size += 1 +
+        ::google::protobuf::internal::WireFormatLite::Int32Size(data_size);
+    }
+    GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
+    _playerids_cached_byte_size_ = data_size;
+    GOOGLE_SAFE_CONCURRENT_WRITES_END();
+    total_size += data_size;
+  }
+
+  // repeated .GameListNewMessage games = 2;
+  total_size += 1 * this->games_size();
+  for (int i = 0; i < this->games_size(); i++) {
+    total_size +=
+      ::google::protobuf::internal::WireFormatLite::MessageSizeNoVirtual(
+        this->games(i));
+  }
+
+  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
+  _cached_size_ = total_size;
+  GOOGLE_SAFE_CONCURRENT_WRITES_END();
+  return total_size;
+}
+
+void LobbySnapshotMessage::CheckTypeAndMergeFrom(
+    const ::google::protobuf::MessageLite& from) {
+  MergeFrom(*::google::protobuf::down_cast<const LobbySnapshotMessage*>(&from));
+}
+
+void LobbySnapshotMessage::MergeFrom(const LobbySnapshotMessage& from) {
+  GOOGLE_CHECK_NE(&from, this);
+  playerids_.MergeFrom(from.playerids_);
+  games_.MergeFrom(from.games_);
+}
+
+void LobbySnapshotMessage::CopyFrom(const LobbySnapshotMessage& from) {
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool LobbySnapshotMessage::IsInitialized() const {
+
+  for (int i = 0; i < games_size(); i++) {
+    if (!this->games(i).IsInitialized()) return false;
+  }
+  return true;
+}
+
+void LobbySnapshotMessage::Swap(LobbySnapshotMessage* other) {
+  if (other != this) {
+    playerids_.Swap(&other->playerids_);
+    games_.Swap(&other->games_);
+    std::swap(_has_bits_[0], other->_has_bits_[0]);
+    std::swap(_cached_size_, other->_cached_size_);
+  }
+}
+
+::std::string LobbySnapshotMessage::GetTypeName() const {
+  return "LobbySnapshotMessage";
+}
+
+
 // ===================================================================
 
 #ifndef _MSC_VER
@@ -22046,6 +22338,215 @@ void AdminBanPlayerAckMessage::Swap(AdminBanPlayerAckMessage* other) {
 }
 
 
+// ===================================================================
+
+#ifndef _MSC_VER
+const int CompressedPacketsMessage::kUncompressedSizeFieldNumber;
+const int CompressedPacketsMessage::kCompressedDataFieldNumber;
+#endif  // !_MSC_VER
+
+CompressedPacketsMessage::CompressedPacketsMessage()
+  : ::google::protobuf::MessageLite() {
+  SharedCtor();
+}
+
+void CompressedPacketsMessage::InitAsDefaultInstance() {
+}
+
+CompressedPacketsMessage::CompressedPacketsMessage(const CompressedPacketsMessage& from)
+  : ::google::protobuf::MessageLite() {
+  SharedCtor();
+  MergeFrom(from);
+}
+
+void CompressedPacketsMessage::SharedCtor() {
+  _cached_size_ = 0;
+  uncompressedsize_ = 0u;
+  compresseddata_ = const_cast< ::std::string*>(&::google::protobuf::internal::kEmptyString);
+  ::memset(_has_bits_, 0, sizeof(_has_bits_));
+}
+
+CompressedPacketsMessage::~CompressedPacketsMessage() {
+  SharedDtor();
+}
+
+void CompressedPacketsMessage::SharedDtor() {
+  if (compresseddata_ != &::google::protobuf::internal::kEmptyString) {
+    delete compresseddata_;
+  }
+  #ifdef GOOGLE_PROTOBUF_NO_STATIC_INITIALIZER
+  if (this != &default_instance()) {
+  #else
+  if (this != default_instance_) {
+  #endif
+  }
+}
+
+void CompressedPacketsMessage::SetCachedSize(int size) const {
+  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
+  _cached_size_ = size;
+  GOOGLE_SAFE_CONCURRENT_WRITES_END();
+}
+const CompressedPacketsMessage& CompressedPacketsMessage::default_instance() {
+#ifdef GOOGLE_PROTOBUF_NO_STATIC_INITIALIZER
+  protobuf_AddDesc_pokerth_2eproto();
+#else
+  if (default_instance_ == NULL) protobuf_AddDesc_pokerth_2eproto();
+#endif
+  return *default_instance_;
+}
+
+CompressedPacketsMessage* CompressedPacketsMessage::default_instance_ = NULL;
+
+CompressedPacketsMessage* CompressedPacketsMessage::New() const {
+  return new CompressedPacketsMessage;
+}
+
+void CompressedPacketsMessage::Clear() {
+  if (_has_bits_[0 / 32] & (0xffu << (0 % 32))) {
+    uncompressedsize_ = 0u;
+    if (has_compresseddata()) {
+      if (compresseddata_ != &::google::protobuf::internal::kEmptyString) {
+        compresseddata_->clear();
+      }
+    }
+  }
+  ::memset(_has_bits_, 0, sizeof(_has_bits_));
+}
+
+bool CompressedPacketsMessage::MergePartialFromCodedStream(
+    ::google::protobuf::io::CodedInputStream* input) {
+#define DO_(EXPRESSION) if (!(EXPRESSION)) return false
+  ::google::protobuf::uint32 tag;
+  while ((tag = input->ReadTag()) != 0) {
+    switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
+      // required uint32 uncompressedSize = 1;
+      case 1: {
+        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
+            ::google::protobuf::internal::WireFormatLite::WIRETYPE_VARINT) {
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   ::google::protobuf::uint32, ::google::protobuf::internal::WireFormatLite::TYPE_UINT32>(
+                 input, &uncompressedsize_)));
+          set_has_uncompressedsize();
+        } else {
+          goto handle_uninterpreted;
+        }
+        if (input->ExpectTag(18)) goto parse_compressedData;
+        break;
+      }
+
+      // required bytes compressedData = 2;
+      case 2: {
+        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
+            ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED) {
+         parse_compressedData:
+          DO_(::google::protobuf::internal::WireFormatLite::ReadBytes(
+                input, this->mutable_compresseddata()));
+        } else {
+          goto handle_uninterpreted;
+        }
+        if (input->ExpectAtEnd()) return true;
+        break;
+      }
+
+      default: {
+      handle_uninterpreted:
+        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
+            ::google::protobuf::internal::WireFormatLite::WIRETYPE_END_GROUP) {
+          return true;
+        }
+        DO_(::google::protobuf::internal::WireFormatLite::SkipField(input, tag));
+        break;
+      }
+    }
+  }
+  return true;
+#undef DO_
+}
+
+void CompressedPacketsMessage::SerializeWithCachedSizes(
+    ::google::protobuf::io::CodedOutputStream* output) const {
+  // required uint32 uncompressedSize = 1;
+  if (has_uncompressedsize()) {
+    ::google::protobuf::internal::WireFormatLite::WriteUInt32(1, this->uncompressedsize(), output);
+  }
+
+  // required bytes compressedData = 2;
+  if (has_compresseddata()) {
+    ::google::protobuf::internal::WireFormatLite::WriteBytes(
+      2, this->compresseddata(), output);
+  }
+
+}
+
+int CompressedPacketsMessage::ByteSize() const {
+  int total_size = 0;
+
+  if (_has_bits_[0 / 32] & (0xffu << (0 % 32))) {
+    // required uint32 uncompressedSize = 1;
+    if (has_uncompressedsize()) {
+      total_size += 1 +
+        ::google::protobuf::internal::WireFormatLite::UInt32Size(
+          this->uncompressedsize());
+    }
+
+    // required bytes compressedData = 2;
+    if (has_compresseddata()) {
+      total_size += 1 +
+        ::google::protobuf::internal::WireFormatLite::BytesSize(
+          this->compresseddata());
+    }
+
+  }
+  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
+  _cached_size_ = total_size;
+  GOOGLE_SAFE_CONCURRENT_WRITES_END();
+  return total_size;
+}
+
+void CompressedPacketsMessage::CheckTypeAndMergeFrom(
+    const ::google::protobuf::MessageLite& from) {
+  MergeFrom(*::google::protobuf::down_cast<const CompressedPacketsMessage*>(&from));
+}
+
+void CompressedPacketsMessage::MergeFrom(const CompressedPacketsMessage& from) {
+  GOOGLE_CHECK_NE(&from, this);
+  if (from._has_bits_[0 / 32] & (0xffu << (0 % 32))) {
+    if (from.has_uncompressedsize()) {
+      set_uncompressedsize(from.uncompressedsize());
+    }
+    if (from.has_compresseddata()) {
+      set_compresseddata(from.compresseddata());
+    }
+  }
+}
+
+void CompressedPacketsMessage::CopyFrom(const CompressedPacketsMessage& from) {
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool CompressedPacketsMessage::IsInitialized() const {
+  if ((_has_bits_[0] & 0x00000003) != 0x00000003) return false;
+
+  return true;
+}
+
+void CompressedPacketsMessage::Swap(CompressedPacketsMessage* other) {
+  if (other != this) {
+    std::swap(uncompressedsize_, other->uncompressedsize_);
+    std::swap(compresseddata_, other->compresseddata_);
+    std::swap(_has_bits_[0], other->_has_bits_[0]);
+    std::swap(_cached_size_, other->_cached_size_);
+  }
+}
+
+::std::string CompressedPacketsMessage::GetTypeName() const {
+  return "CompressedPacketsMessage";
+}
+
+
 // ===================================================================
 
 bool PokerTHMessage_PokerTHMessageType_IsValid(int value) {
@@ -22131,6 +22632,8 @@ bool PokerTHMessage_PokerTHMessageType_IsValid(int value) {
     case 79:
     case 80:
     case 81:
+    case 82:
+    case 83:
       return true;
     default:
       return false;
@@ -22219,6 +22722,8 @@ const PokerTHMessage_PokerTHMessageType PokerTHMessage::Type_GameListSpectatorJo
 const PokerTHMessage_PokerTHMessageType PokerTHMessage::Type_GameListSpectatorLeftMessage;
 const PokerTHMessage_PokerTHMessageType PokerTHMessage::Type_GameSpectatorJoinedMessage;
 const PokerTHMessage_PokerTHMessageType PokerTHMessage::Type_GameSpectatorLeftMessage;
+const PokerTHMessage_PokerTHMessageType PokerTHMessage::Type_LobbySnapshotMessage;
+const PokerTHMessage_PokerTHMessageType PokerTHMessage::Type_CompressedPacketsMessage;
 const PokerTHMessage_PokerTHMessageType PokerTHMessage::PokerTHMessageType_MIN;
 const PokerTHMessage_PokerTHMessageType PokerTHMessage::PokerTHMessageType_MAX;
 const int PokerTHMessage::PokerTHMessageType_ARRAYSIZE;
@@ -22306,6 +22811,8 @@ const int PokerTHMessage::kGameListSpectatorJoinedMessageFieldNumber;
 const int PokerTHMessage::kGameListSpectatorLeftMessageFieldNumber;
 const int PokerTHMessage::kGameSpectatorJoinedMessageFieldNumber;
 const int PokerTHMessage::kGameSpectatorLeftMessageFieldNumber;
+const int PokerTHMessage::kLobbySnapshotMessageFieldNumber;
+const int PokerTHMessage::kCompressedPacketsMessageFieldNumber;
 #endif  // !_MSC_VER
 
 PokerTHMessage::PokerTHMessage()
@@ -22800,6 +23307,18 @@ void PokerTHMessage::InitAsDefaultInstance() {
 #else
   gamespectatorleftmessage_ = const_cast< ::GameSpectatorLeftMessage*>(&::GameSpectatorLeftMessage::default_instance());
 #endif
+#ifdef GOOGLE_PROTOBUF_NO_STATIC_INITIALIZER
+  lobbysnapshotmessage_ = const_cast< ::LobbySnapshotMessage*>(
+      ::LobbySnapshotMessage::internal_default_instance());
+#else
+  lobbysnapshotmessage_ = const_cast< ::LobbySnapshotMessage*>(&::LobbySnapshotMessage::default_instance());
+#endif
+#ifdef GOOGLE_PROTOBUF_NO_STATIC_INITIALIZER
+  compressedpacketsmessage_ = const_cast< ::CompressedPacketsMessage*>(
+      ::CompressedPacketsMessage::internal_default_instance());
+#else
+  compressedpacketsmessage_ = const_cast< ::CompressedPacketsMessage*>(&::CompressedPacketsMessage::default_instance());
+#endif
 }
 
 PokerTHMessage::PokerTHMessage(const PokerTHMessage& from)
@@ -22892,6 +23411,8 @@ void PokerTHMessage::SharedCtor() {
   gamelistspectatorleftmessage_ = NULL;
   gamespectatorjoinedmessage_ = NULL;
   gamespectatorleftmessage_ = NULL;
+  lobbysnapshotmessage_ = NULL;
+  compressedpacketsmessage_ = NULL;
   ::memset(_has_bits_, 0, sizeof(_has_bits_));
 }
 
@@ -22986,6 +23507,8 @@ void PokerTHMessage::SharedDtor() {
     delete gamelistspectatorleftmessage_;
     delete gamespectatorjoinedmessage_;
     delete gamespectatorleftmessage_;
+    delete lobbysnapshotmessage_;
+    delete compressedpacketsmessage_;
   }
 }
 
@@ -23275,6 +23798,12 @@ void PokerTHMessage::Clear() {
     if (has_gamespectatorleftmessage()) {
       if (gamespectatorleftmessage_ != NULL) gamespectatorleftmessage_->::GameSpectatorLeftMessage::Clear();
     }
+    if (has_lobbysnapshotmessage()) {
+      if (lobbysnapshotmessage_ != NULL) lobbysnapshotmessage_->::LobbySnapshotMessage::Clear();
+    }
+    if (has_compressedpacketsmessage()) {
+      if (compressedpacketsmessage_ != NULL) compressedpacketsmessage_->::CompressedPacketsMessage::Clear();
+    }
   }
   ::memset(_has_bits_, 0, sizeof(_has_bits_));
 }
@@ -24433,6 +24962,34 @@ bool PokerTHMessage::MergePartialFromCodedStream(
         } else {
           goto handle_uninterpreted;
         }
+        if (input->ExpectTag(666)) goto parse_lobbySnapshotMessage;
+        break;
+      }
+
+      // optional .LobbySnapshotMessage lobbySnapshotMessage = 83;
+      case 83: {
+        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
+            ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED) {
+         parse_lobbySnapshotMessage:
+          DO_(::google::protobuf::internal::WireFormatLite::ReadMessageNoVirtual(
+               input, mutable_lobbysnapshotmessage()));
+        } else {
+          goto handle_uninterpreted;
+        }
+        if (input->ExpectTag(674)) goto parse_compressedPacketsMessage;
+        break;
+      }
+
+      // optional .CompressedPacketsMessage compressedPacketsMessage = 84;
+      case 84: {
+        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
+            ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED) {
+         parse_compressedPacketsMessage:
+          DO_(::google::protobuf::internal::WireFormatLite::ReadMessageNoVirtual(
+               input, mutable_compressedpacketsmessage()));
+        } else {
+          goto handle_uninterpreted;
+        }
         if (input->ExpectAtEnd()) return true;
         break;
       }
@@ -24946,6 +25503,18 @@ void PokerTHMessage::SerializeWithCachedSizes(
       82, this->gamespectatorleftmessage(), output);
   }
 
+  // optional .LobbySnapshotMessage lobbySnapshotMessage = 83;
+  if (has_lobbysnapshotmessage()) {
+    ::google::protobuf::internal::WireFormatLite::WriteMessage(
+      83, this->lobbysnapshotmessage(), output);
+  }
+
+  // optional .CompressedPacketsMessage compressedPacketsMessage = 84;
+  if (has_compressedpacketsmessage()) {
+    ::google::protobuf::internal::WireFormatLite::WriteMessage(
+      84, this->compressedpacketsmessage(), output);
+  }
+
 }
 
 int PokerTHMessage::ByteSize() const {
@@ -25545,6 +26114,20 @@ int PokerTHMessage::ByteSize() const {
           this->gamespectatorleftmessage());
     }
 
+    // optional .LobbySnapshotMessage lobbySnapshotMessage = 83;
+    if (has_lobbysnapshotmessage()) {
+      total_size += 2 +
+        ::google::protobuf::internal::WireFormatLite::MessageSizeNoVirtual(
+          this->lobbysnapshotmessage());
+    }
+
+    // optional .CompressedPacketsMessage compressedPacketsMessage = 84;
+    if (has_compressedpacketsmessage()) {
+      total_size += 2 +
+        ::google::protobuf::internal::WireFormatLite::MessageSizeNoVirtual(
+          this->compressedpacketsmessage());
+    }
+
   }
   GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
   _cached_size_ = total_size;
@@ -25826,6 +26409,12 @@ void PokerTHMessage::MergeFrom(const PokerTHMessage& from) {
     if (from.has_gamespectatorleftmessage()) {
       mutable_gamespectatorleftmessage()->::GameSpectatorLeftMessage::MergeFrom(from.gamespectatorleftmessage());
     }
+    if (from.has_lobbysnapshotmessage()) {
+      mutable_lobbysnapshotmessage()->::LobbySnapshotMessage::MergeFrom(from.lobbysnapshotmessage());
+    }
+    if (from.has_compressedpacketsmessage()) {
+      mutable_compressedpacketsmessage()->::CompressedPacketsMessage::MergeFrom(from.compressedpacketsmessage());
+    }
   }
 }
 
@@ -26072,6 +26661,12 @@ bool PokerTHMessage::IsInitialized() const {
   if (has_gamespectatorleftmessage()) {
     if (!this->gamespectatorleftmessage().IsInitialized()) return false;
   }
+  if (has_lobbysnapshotmessage()) {
+    if (!this->lobbysnapshotmessage().IsInitialized()) return false;
+  }
+  if (has_compressedpacketsmessage()) {
+    if (!this->compressedpacketsmessage().IsInitialized()) return false;
+  }
   return true;
 }
 
@@ -26159,6 +26754,8 @@ void PokerTHMessage::Swap(PokerTHMessage* other) {
     std::swap(gamelistspectatorleftmessage_, other->gamelistspectatorleftmessage_);
     std::swap(gamespectatorjoinedmessage_, other->gamespectatorjoinedmessage_);
     std::swap(gamespectatorleftmessage_, other->gamespectatorleftmessage_);
+    std::swap(lobbysnapshotmessage_, other->lobbysnapshotmessage_);
+    std::swap(compressedpacketsmessage_, other->compressedpacketsmessage_);
     std::swap(_has_bits_[0], other->_has_bits_[0]);
     std::swap(_has_bits_[1], other->_has_bits_[1]);
     std::swap(_has_bits_[2], other->_has_bits_[2]);
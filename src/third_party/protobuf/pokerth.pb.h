@@ -46,6 +46,7 @@ class AvatarEndMessage;
 class UnknownAvatarMessage;
 class PlayerListMessage;
 class GameListNewMessage;
+class LobbySnapshotMessage;
 class GameListUpdateMessage;
 class GameListPlayerJoinedMessage;
 class GameListPlayerLeftMessage;
@@ -120,6 +121,7 @@ class AdminRemoveGameMessage;
 class AdminRemoveGameAckMessage;
 class AdminBanPlayerMessage;
 class AdminBanPlayerAckMessage;
+class CompressedPacketsMessage;
 class PokerTHMessage;
 
 enum NetGameInfo_NetGameType {
@@ -468,11 +470,13 @@ enum PokerTHMessage_PokerTHMessageType {
   PokerTHMessage_PokerTHMessageType_Type_GameListSpectatorJoinedMessage = 78,
   PokerTHMessage_PokerTHMessageType_Type_GameListSpectatorLeftMessage = 79,
   PokerTHMessage_PokerTHMessageType_Type_GameSpectatorJoinedMessage = 80,
-  PokerTHMessage_PokerTHMessageType_Type_GameSpectatorLeftMessage = 81
+  PokerTHMessage_PokerTHMessageType_Type_GameSpectatorLeftMessage = 81,
+  PokerTHMessage_PokerTHMessageType_Type_LobbySnapshotMessage = 82,
+  PokerTHMessage_PokerTHMessageType_Type_CompressedPacketsMessage = 83
 };
 bool PokerTHMessage_PokerTHMessageType_IsValid(int value);
 const PokerTHMessage_PokerTHMessageType PokerTHMessage_PokerTHMessageType_PokerTHMessageType_MIN = PokerTHMessage_PokerTHMessageType_Type_AnnounceMessage;
-const PokerTHMessage_PokerTHMessageType PokerTHMessage_PokerTHMessageType_PokerTHMessageType_MAX = PokerTHMessage_PokerTHMessageType_Type_GameSpectatorLeftMessage;
+const PokerTHMessage_PokerTHMessageType PokerTHMessage_PokerTHMessageType_PokerTHMessageType_MAX = PokerTHMessage_PokerTHMessageType_Type_CompressedPacketsMessage;
 const int PokerTHMessage_PokerTHMessageType_PokerTHMessageType_ARRAYSIZE = PokerTHMessage_PokerTHMessageType_PokerTHMessageType_MAX + 1;
 
 enum NetGameMode {
@@ -1351,6 +1355,20 @@ class InitMessage : public ::google::protobuf::MessageLite {
   inline ::std::string* release_avatarhash();
   inline void set_allocated_avatarhash(::std::string* avatarhash);
 
+  // optional bool supportsCompression = 9;
+  inline bool has_supportscompression() const;
+  inline void clear_supportscompression();
+  static const int kSupportsCompressionFieldNumber = 9;
+  inline bool supportscompression() const;
+  inline void set_supportscompression(bool value);
+
+  // optional bool acceptsFastForward = 10;
+  inline bool has_acceptsfastforward() const;
+  inline void clear_acceptsfastforward();
+  static const int kAcceptsFastForwardFieldNumber = 10;
+  inline bool acceptsfastforward() const;
+  inline void set_acceptsfastforward(bool value);
+
   // @@protoc_insertion_point(class_scope:InitMessage)
  private:
   inline void set_has_requestedversion();
@@ -1369,6 +1387,10 @@ class InitMessage : public ::google::protobuf::MessageLite {
   inline void clear_has_clientuserdata();
   inline void set_has_avatarhash();
   inline void clear_has_avatarhash();
+  inline void set_has_supportscompression();
+  inline void clear_has_supportscompression();
+  inline void set_has_acceptsfastforward();
+  inline void clear_has_acceptsfastforward();
 
   ::AnnounceMessage_Version* requestedversion_;
   ::std::string* mylastsessionid_;
@@ -1378,9 +1400,11 @@ class InitMessage : public ::google::protobuf::MessageLite {
   ::std::string* nickname_;
   ::std::string* clientuserdata_;
   ::std::string* avatarhash_;
+  bool supportscompression_;
+  bool acceptsfastforward_;
 
   mutable int _cached_size_;
-  ::google::protobuf::uint32 _has_bits_[(8 + 31) / 32];
+  ::google::protobuf::uint32 _has_bits_[(10 + 31) / 32];
 
   #ifdef GOOGLE_PROTOBUF_NO_STATIC_INITIALIZER
   friend void  protobuf_AddDesc_pokerth_2eproto_impl();
@@ -2506,6 +2530,106 @@ class GameListNewMessage : public ::google::protobuf::MessageLite {
 };
 // -------------------------------------------------------------------
 
+class LobbySnapshotMessage : public ::google::protobuf::MessageLite {
+ public:
+  LobbySnapshotMessage();
+  virtual ~LobbySnapshotMessage();
+
+  LobbySnapshotMessage(const LobbySnapshotMessage& from);
+
+  inline LobbySnapshotMessage& operator=(const LobbySnapshotMessage& from) {
+    CopyFrom(from);
+    return *this;
+  }
+
+  static const LobbySnapshotMessage& default_instance();
+
+  #ifdef GOOGLE_PROTOBUF_NO_STATIC_INITIALIZER
+  // Returns the internal default instance pointer. This function can
+  // return NULL thus should not be used by the user. This is intended
+  // for Protobuf internal code. Please use default_instance() declared
+  // above instead.
+  static inline const LobbySnapshotMessage* internal_default_instance() {
+    return default_instance_;
+  }
+  #endif
+
+  void Swap(LobbySnapshotMessage* other);
+
+  // implements Message ----------------------------------------------
+
+  LobbySnapshotMessage* New() const;
+  void CheckTypeAndMergeFrom(const ::google::protobuf::MessageLite& from);
+  void CopyFrom(const LobbySnapshotMessage& from);
+  void MergeFrom(const LobbySnapshotMessage& from);
+  void Clear();
+  bool IsInitialized() const;
+
+  int ByteSize() const;
+  bool MergePartialFromCodedStream(
+      ::google::protobuf::io::CodedInputStream* input);
+  void SerializeWithCachedSizes(
+      ::google::protobuf::io::CodedOutputStream* output) const;
+  int GetCachedSize() const { return _cached_size_; }
+  private:
+  void SharedCtor();
+  void SharedDtor();
+  void SetCachedSize(int size) const;
+  public:
+
+  ::std::string GetTypeName() const;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  // repeated uint32 playerIds = 1 [packed = true];
+  inline int playerids_size() const;
+  inline void clear_playerids();
+  static const int kPlayerIdsFieldNumber = 1;
+  inline ::google::protobuf::uint32 playerids(int index) const;
+  inline void set_playerids(int index, ::google::protobuf::uint32 value);
+  inline void add_playerids(::google::protobuf::uint32 value);
+  inline const ::google::protobuf::RepeatedField< ::google::protobuf::uint32 >&
+      playerids() const;
+  inline ::google::protobuf::RepeatedField< ::google::protobuf::uint32 >*
+      mutable_playerids();
+
+  // repeated .GameListNewMessage games = 2;
+  inline int games_size() const;
+  inline void clear_games();
+  static const int kGamesFieldNumber = 2;
+  inline const ::GameListNewMessage& games(int index) const;
+  inline ::GameListNewMessage* mutable_games(int index);
+  inline ::GameListNewMessage* add_games();
+  inline const ::google::protobuf::RepeatedPtrField< ::GameListNewMessage >&
+      games() const;
+  inline ::google::protobuf::RepeatedPtrField< ::GameListNewMessage >*
+      mutable_games();
+
+  // @@protoc_insertion_point(class_scope:LobbySnapshotMessage)
+ private:
+
+  ::google::protobuf::RepeatedField< ::google::protobuf::uint32 > playerids_;
+  mutable int _playerids_cached_byte_size_;
+  ::google::protobuf::RepeatedPtrField< ::GameListNewMessage > games_;
+
+  mutable int _cached_size_;
+  ::google::protobuf::uint32 _has_bits_[(2 + 31) / 32];
+
+  #ifdef GOOGLE_PROTOBUF_NO_STATIC_INITIALIZER
+  friend void  protobuf_AddDesc_pokerth_2eproto_impl();
+  #else
+  friend void  protobuf_AddDesc_pokerth_2eproto();
+  #endif
+  friend void protobuf_AssignDesc_pokerth_2eproto();
+  friend void protobuf_ShutdownFile_pokerth_2eproto();
+
+  void InitAsDefaultInstance();
+  static LobbySnapshotMessage* default_instance_;
+};
+// -------------------------------------------------------------------
+
 class GameListUpdateMessage : public ::google::protobuf::MessageLite {
  public:
   GameListUpdateMessage();
@@ -10166,6 +10290,104 @@ class AdminBanPlayerAckMessage : public ::google::protobuf::MessageLite {
 };
 // -------------------------------------------------------------------
 
+class CompressedPacketsMessage : public ::google::protobuf::MessageLite {
+ public:
+  CompressedPacketsMessage();
+  virtual ~CompressedPacketsMessage();
+
+  CompressedPacketsMessage(const CompressedPacketsMessage& from);
+
+  inline CompressedPacketsMessage& operator=(const CompressedPacketsMessage& from) {
+    CopyFrom(from);
+    return *this;
+  }
+
+  static const CompressedPacketsMessage& default_instance();
+
+  #ifdef GOOGLE_PROTOBUF_NO_STATIC_INITIALIZER
+  // Returns the internal default instance pointer. This function can
+  // return NULL thus should not be used by the user. This is intended
+  // for Protobuf internal code. Please use default_instance() declared
+  // above instead.
+  static inline const CompressedPacketsMessage* internal_default_instance() {
+    return default_instance_;
+  }
+  #endif
+
+  void Swap(CompressedPacketsMessage* other);
+
+  // implements Message ----------------------------------------------
+
+  CompressedPacketsMessage* New() const;
+  void CheckTypeAndMergeFrom(const ::google::protobuf::MessageLite& from);
+  void CopyFrom(const CompressedPacketsMessage& from);
+  void MergeFrom(const CompressedPacketsMessage& from);
+  void Clear();
+  bool IsInitialized() const;
+
+  int ByteSize() const;
+  bool MergePartialFromCodedStream(
+      ::google::protobuf::io::CodedInputStream* input);
+  void SerializeWithCachedSizes(
+      ::google::protobuf::io::CodedOutputStream* output) const;
+  int GetCachedSize() const { return _cached_size_; }
+  private:
+  void SharedCtor();
+  void SharedDtor();
+  void SetCachedSize(int size) const;
+  public:
+
+  ::std::string GetTypeName() const;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  // required uint32 uncompressedSize = 1;
+  inline bool has_uncompressedsize() const;
+  inline void clear_uncompressedsize();
+  static const int kUncompressedSizeFieldNumber = 1;
+  inline ::google::protobuf::uint32 uncompressedsize() const;
+  inline void set_uncompressedsize(::google::protobuf::uint32 value);
+
+  // required bytes compressedData = 2;
+  inline bool has_compresseddata() const;
+  inline void clear_compresseddata();
+  static const int kCompressedDataFieldNumber = 2;
+  inline const ::std::string& compresseddata() const;
+  inline void set_compresseddata(const ::std::string& value);
+  inline void set_compresseddata(const char* value);
+  inline void set_compresseddata(const void* value, size_t size);
+  inline ::std::string* mutable_compresseddata();
+  inline ::std::string* release_compresseddata();
+  inline void set_allocated_compresseddata(::std::string* compresseddata);
+
+  // @@protoc_insertion_point(class_scope:CompressedPacketsMessage)
+ private:
+  inline void set_has_uncompressedsize();
+  inline void clear_has_uncompressedsize();
+  inline void set_has_compresseddata();
+  inline void clear_has_compresseddata();
+
+  ::std::string* compresseddata_;
+  ::google::protobuf::uint32 uncompressedsize_;
+
+  mutable int _cached_size_;
+  ::google::protobuf::uint32 _has_bits_[(2 + 31) / 32];
+
+  #ifdef GOOGLE_PROTOBUF_NO_STATIC_INITIALIZER
+  friend void  protobuf_AddDesc_pokerth_2eproto_impl();
+  #else
+  friend void  protobuf_AddDesc_pokerth_2eproto();
+  #endif
+  friend void protobuf_AssignDesc_pokerth_2eproto();
+  friend void protobuf_ShutdownFile_pokerth_2eproto();
+
+  void InitAsDefaultInstance();
+  static CompressedPacketsMessage* default_instance_;
+};
+// -------------------------------------------------------------------
+
 class PokerTHMessage : public ::google::protobuf::MessageLite {
  public:
   PokerTHMessage();
@@ -10299,6 +10521,8 @@ class PokerTHMessage : public ::google::protobuf::MessageLite {
   static const PokerTHMessageType Type_GameListSpectatorLeftMessage = PokerTHMessage_PokerTHMessageType_Type_GameListSpectatorLeftMessage;
   static const PokerTHMessageType Type_GameSpectatorJoinedMessage = PokerTHMessage_PokerTHMessageType_Type_GameSpectatorJoinedMessage;
   static const PokerTHMessageType Type_GameSpectatorLeftMessage = PokerTHMessage_PokerTHMessageType_Type_GameSpectatorLeftMessage;
+  static const PokerTHMessageType Type_LobbySnapshotMessage = PokerTHMessage_PokerTHMessageType_Type_LobbySnapshotMessage;
+  static const PokerTHMessageType Type_CompressedPacketsMessage = PokerTHMessage_PokerTHMessageType_Type_CompressedPacketsMessage;
   static inline bool PokerTHMessageType_IsValid(int value) {
     return PokerTHMessage_PokerTHMessageType_IsValid(value);
   }
@@ -11047,6 +11271,24 @@ class PokerTHMessage : public ::google::protobuf::MessageLite {
   inline ::GameSpectatorLeftMessage* release_gamespectatorleftmessage();
   inline void set_allocated_gamespectatorleftmessage(::GameSpectatorLeftMessage* gamespectatorleftmessage);
 
+  // optional .LobbySnapshotMessage lobbySnapshotMessage = 83;
+  inline bool has_lobbysnapshotmessage() const;
+  inline void clear_lobbysnapshotmessage();
+  static const int kLobbySnapshotMessageFieldNumber = 83;
+  inline const ::LobbySnapshotMessage& lobbysnapshotmessage() const;
+  inline ::LobbySnapshotMessage* mutable_lobbysnapshotmessage();
+  inline ::LobbySnapshotMessage* release_lobbysnapshotmessage();
+  inline void set_allocated_lobbysnapshotmessage(::LobbySnapshotMessage* lobbysnapshotmessage);
+
+  // optional .CompressedPacketsMessage compressedPacketsMessage = 84;
+  inline bool has_compressedpacketsmessage() const;
+  inline void clear_compressedpacketsmessage();
+  static const int kCompressedPacketsMessageFieldNumber = 84;
+  inline const ::CompressedPacketsMessage& compressedpacketsmessage() const;
+  inline ::CompressedPacketsMessage* mutable_compressedpacketsmessage();
+  inline ::CompressedPacketsMessage* release_compressedpacketsmessage();
+  inline void set_allocated_compressedpacketsmessage(::CompressedPacketsMessage* compressedpacketsmessage);
+
   // @@protoc_insertion_point(class_scope:PokerTHMessage)
  private:
   inline void set_has_messagetype();
@@ -11213,6 +11455,10 @@ class PokerTHMessage : public ::google::protobuf::MessageLite {
   inline void clear_has_gamespectatorjoinedmessage();
   inline void set_has_gamespectatorleftmessage();
   inline void clear_has_gamespectatorleftmessage();
+  inline void set_has_lobbysnapshotmessage();
+  inline void clear_has_lobbysnapshotmessage();
+  inline void set_has_compressedpacketsmessage();
+  inline void clear_has_compressedpacketsmessage();
 
   ::AnnounceMessage* announcemessage_;
   ::InitMessage* initmessage_;
@@ -11295,10 +11541,12 @@ class PokerTHMessage : public ::google::protobuf::MessageLite {
   ::GameListSpectatorLeftMessage* gamelistspectatorleftmessage_;
   ::GameSpectatorJoinedMessage* gamespectatorjoinedmessage_;
   ::GameSpectatorLeftMessage* gamespectatorleftmessage_;
+  ::LobbySnapshotMessage* lobbysnapshotmessage_;
+  ::CompressedPacketsMessage* compressedpacketsmessage_;
   int messagetype_;
 
   mutable int _cached_size_;
-  ::google::protobuf::uint32 _has_bits_[(82 + 31) / 32];
+  ::google::protobuf::uint32 _has_bits_[(84 + 31) / 32];
 
   #ifdef GOOGLE_PROTOBUF_NO_STATIC_INITIALIZER
   friend void  protobuf_AddDesc_pokerth_2eproto_impl();
@@ -12507,6 +12755,50 @@ inline void InitMessage::set_allocated_avatarhash(::std::string* avatarhash) {
   }
 }
 
+// optional bool supportsCompression = 9;
+inline bool InitMessage::has_supportscompression() const {
+  return (_has_bits_[0] & 0x00000100u) != 0;
+}
+inline void InitMessage::set_has_supportscompression() {
+  _has_bits_[0] |= 0x00000100u;
+}
+inline void InitMessage::clear_has_supportscompression() {
+  _has_bits_[0] &= ~0x00000100u;
+}
+inline void InitMessage::clear_supportscompression() {
+  supportscompression_ = false;
+  clear_has_supportscompression();
+}
+inline bool InitMessage::supportscompression() const {
+  return supportscompression_;
+}
+inline void InitMessage::set_supportscompression(bool value) {
+  set_has_supportscompression();
+  supportscompression_ = value;
+}
+
+// optional bool acceptsFastForward = 10;
+inline bool InitMessage::has_acceptsfastforward() const {
+  return (_has_bits_[0] & 0x00000200u) != 0;
+}
+inline void InitMessage::set_has_acceptsfastforward() {
+  _has_bits_[0] |= 0x00000200u;
+}
+inline void InitMessage::clear_has_acceptsfastforward() {
+  _has_bits_[0] &= ~0x00000200u;
+}
+inline void InitMessage::clear_acceptsfastforward() {
+  acceptsfastforward_ = false;
+  clear_has_acceptsfastforward();
+}
+inline bool InitMessage::acceptsfastforward() const {
+  return acceptsfastforward_;
+}
+inline void InitMessage::set_acceptsfastforward(bool value) {
+  set_has_acceptsfastforward();
+  acceptsfastforward_ = value;
+}
+
 // -------------------------------------------------------------------
 
 // AuthServerChallengeMessage
@@ -13468,6 +13760,60 @@ GameListNewMessage::mutable_spectatorids() {
 
 // -------------------------------------------------------------------
 
+// LobbySnapshotMessage
+
+// repeated uint32 playerIds = 1 [packed = true];
+inline int LobbySnapshotMessage::playerids_size() const {
+  return playerids_.size();
+}
+inline void LobbySnapshotMessage::clear_playerids() {
+  playerids_.Clear();
+}
+inline ::google::protobuf::uint32 LobbySnapshotMessage::playerids(int index) const {
+  return playerids_.Get(index);
+}
+inline void LobbySnapshotMessage::set_playerids(int index, ::google::protobuf::uint32 value) {
+  playerids_.Set(index, value);
+}
+inline void LobbySnapshotMessage::add_playerids(::google::protobuf::uint32 value) {
+  playerids_.Add(value);
+}
+inline const ::google::protobuf::RepeatedField< ::google::protobuf::uint32 >&
+LobbySnapshotMessage::playerids() const {
+  return playerids_;
+}
+inline ::google::protobuf::RepeatedField< ::google::protobuf::uint32 >*
+LobbySnapshotMessage::mutable_playerids() {
+  return &playerids_;
+}
+
+// repeated .GameListNewMessage games = 2;
+inline int LobbySnapshotMessage::games_size() const {
+  return games_.size();
+}
+inline void LobbySnapshotMessage::clear_games() {
+  games_.Clear();
+}
+inline const ::GameListNewMessage& LobbySnapshotMessage::games(int index) const {
+  return games_.Get(index);
+}
+inline ::GameListNewMessage* LobbySnapshotMessage::mutable_games(int index) {
+  return games_.Mutable(index);
+}
+inline ::GameListNewMessage* LobbySnapshotMessage::add_games() {
+  return games_.Add();
+}
+inline const ::google::protobuf::RepeatedPtrField< ::GameListNewMessage >&
+LobbySnapshotMessage::games() const {
+  return games_;
+}
+inline ::google::protobuf::RepeatedPtrField< ::GameListNewMessage >*
+LobbySnapshotMessage::mutable_games() {
+  return &games_;
+}
+
+// -------------------------------------------------------------------
+
 // GameListUpdateMessage
 
 // required uint32 gameId = 1;
@@ -18601,6 +18947,102 @@ inline void AdminBanPlayerAckMessage::set_banplayerresult(::AdminBanPlayerAckMes
 
 // -------------------------------------------------------------------
 
+// CompressedPacketsMessage
+
+// required uint32 uncompressedSize = 1;
+inline bool CompressedPacketsMessage::has_uncompressedsize() const {
+  return (_has_bits_[0] & 0x00000001u) != 0;
+}
+inline void CompressedPacketsMessage::set_has_uncompressedsize() {
+  _has_bits_[0] |= 0x00000001u;
+}
+inline void CompressedPacketsMessage::clear_has_uncompressedsize() {
+  _has_bits_[0] &= ~0x00000001u;
+}
+inline void CompressedPacketsMessage::clear_uncompressedsize() {
+  uncompressedsize_ = 0u;
+  clear_has_uncompressedsize();
+}
+inline ::google::protobuf::uint32 CompressedPacketsMessage::uncompressedsize() const {
+  return uncompressedsize_;
+}
+inline void CompressedPacketsMessage::set_uncompressedsize(::google::protobuf::uint32 value) {
+  set_has_uncompressedsize();
+  uncompressedsize_ = value;
+}
+
+// required bytes compressedData = 2;
+inline bool CompressedPacketsMessage::has_compresseddata() const {
+  return (_has_bits_[0] & 0x00000002u) != 0;
+}
+inline void CompressedPacketsMessage::set_has_compresseddata() {
+  _has_bits_[0] |= 0x00000002u;
+}
+inline void CompressedPacketsMessage::clear_has_compresseddata() {
+  _has_bits_[0] &= ~0x00000002u;
+}
+inline void CompressedPacketsMessage::clear_compresseddata() {
+  if (compresseddata_ != &::google::protobuf::internal::kEmptyString) {
+    compresseddata_->clear();
+  }
+  clear_has_compresseddata();
+}
+inline const ::std::string& CompressedPacketsMessage::compresseddata() const {
+  return *compresseddata_;
+}
+inline void CompressedPacketsMessage::set_compresseddata(const ::std::string& value) {
+  set_has_compresseddata();
+  if (compresseddata_ == &::google::protobuf::internal::kEmptyString) {
+    compresseddata_ = new ::std::string;
+  }
+  compresseddata_->assign(value);
+}
+inline void CompressedPacketsMessage::set_compresseddata(const char* value) {
+  set_has_compresseddata();
+  if (compresseddata_ == &::google::protobuf::internal::kEmptyString) {
+    compresseddata_ = new ::std::string;
+  }
+  compresseddata_->assign(value);
+}
+inline void CompressedPacketsMessage::set_compresseddata(const void* value, size_t size) {
+  set_has_compresseddata();
+  if (compresseddata_ == &::google::protobuf::internal::kEmptyString) {
+    compresseddata_ = new ::std::string;
+  }
+  compresseddata_->assign(reinterpret_cast<const char*>(value), size);
+}
+inline ::std::string* CompressedPacketsMessage::mutable_compresseddata() {
+  set_has_compresseddata();
+  if (compresseddata_ == &::google::protobuf::internal::kEmptyString) {
+    compresseddata_ = new ::std::string;
+  }
+  return compresseddata_;
+}
+inline ::std::string* CompressedPacketsMessage::release_compresseddata() {
+  clear_has_compresseddata();
+  if (compresseddata_ == &::google::protobuf::internal::kEmptyString) {
+    return NULL;
+  } else {
+    ::std::string* temp = compresseddata_;
+    compresseddata_ = const_cast< ::std::string*>(&::google::protobuf::internal::kEmptyString);
+    return temp;
+  }
+}
+inline void CompressedPacketsMessage::set_allocated_compresseddata(::std::string* compresseddata) {
+  if (compresseddata_ != &::google::protobuf::internal::kEmptyString) {
+    delete compresseddata_;
+  }
+  if (compresseddata) {
+    set_has_compresseddata();
+    compresseddata_ = compresseddata;
+  } else {
+    clear_has_compresseddata();
+    compresseddata_ = const_cast< ::std::string*>(&::google::protobuf::internal::kEmptyString);
+  }
+}
+
+// -------------------------------------------------------------------
+
 // PokerTHMessage
 
 // required .PokerTHMessage.PokerTHMessageType messageType = 1;
@@ -22028,6 +22470,90 @@ inline void PokerTHMessage::set_allocated_gamespectatorleftmessage(::GameSpectat
   }
 }
 
+// optional .LobbySnapshotMessage lobbySnapshotMessage = 83;
+inline bool PokerTHMessage::has_lobbysnapshotmessage() const {
+  return (_has_bits_[2] & 0x00040000u) != 0;
+}
+inline void PokerTHMessage::set_has_lobbysnapshotmessage() {
+  _has_bits_[2] |= 0x00040000u;
+}
+inline void PokerTHMessage::clear_has_lobbysnapshotmessage() {
+  _has_bits_[2] &= ~0x00040000u;
+}
+inline void PokerTHMessage::clear_lobbysnapshotmessage() {
+  if (lobbysnapshotmessage_ != NULL) lobbysnapshotmessage_->::LobbySnapshotMessage::Clear();
+  clear_has_lobbysnapshotmessage();
+}
+inline const ::LobbySnapshotMessage& PokerTHMessage::lobbysnapshotmessage() const {
+#ifdef GOOGLE_PROTOBUF_NO_STATIC_INITIALIZER
+  return lobbysnapshotmessage_ != NULL ? *lobbysnapshotmessage_ : *default_instance().lobbysnapshotmessage_;
+#else
+  return lobbysnapshotmessage_ != NULL ? *lobbysnapshotmessage_ : *default_instance_->lobbysnapshotmessage_;
+#endif
+}
+inline ::LobbySnapshotMessage* PokerTHMessage::mutable_lobbysnapshotmessage() {
+  set_has_lobbysnapshotmessage();
+  if (lobbysnapshotmessage_ == NULL) lobbysnapshotmessage_ = new ::LobbySnapshotMessage;
+  return lobbysnapshotmessage_;
+}
+inline ::LobbySnapshotMessage* PokerTHMessage::release_lobbysnapshotmessage() {
+  clear_has_lobbysnapshotmessage();
+  ::LobbySnapshotMessage* temp = lobbysnapshotmessage_;
+  lobbysnapshotmessage_ = NULL;
+  return temp;
+}
+inline void PokerTHMessage::set_allocated_lobbysnapshotmessage(::LobbySnapshotMessage* lobbysnapshotmessage) {
+  delete lobbysnapshotmessage_;
+  lobbysnapshotmessage_ = lobbysnapshotmessage;
+  if (lobbysnapshotmessage) {
+    set_has_lobbysnapshotmessage();
+  } else {
+    clear_has_lobbysnapshotmessage();
+  }
+}
+
+// optional .CompressedPacketsMessage compressedPacketsMessage = 84;
+inline bool PokerTHMessage::has_compressedpacketsmessage() const {
+  return (_has_bits_[2] & 0x00080000u) != 0;
+}
+inline void PokerTHMessage::set_has_compressedpacketsmessage() {
+  _has_bits_[2] |= 0x00080000u;
+}
+inline void PokerTHMessage::clear_has_compressedpacketsmessage() {
+  _has_bits_[2] &= ~0x00080000u;
+}
+inline void PokerTHMessage::clear_compressedpacketsmessage() {
+  if (compressedpacketsmessage_ != NULL) compressedpacketsmessage_->::CompressedPacketsMessage::Clear();
+  clear_has_compressedpacketsmessage();
+}
+inline const ::CompressedPacketsMessage& PokerTHMessage::compressedpacketsmessage() const {
+#ifdef GOOGLE_PROTOBUF_NO_STATIC_INITIALIZER
+  return compressedpacketsmessage_ != NULL ? *compressedpacketsmessage_ : *default_instance().compressedpacketsmessage_;
+#else
+  return compressedpacketsmessage_ != NULL ? *compressedpacketsmessage_ : *default_instance_->compressedpacketsmessage_;
+#endif
+}
+inline ::CompressedPacketsMessage* PokerTHMessage::mutable_compressedpacketsmessage() {
+  set_has_compressedpacketsmessage();
+  if (compressedpacketsmessage_ == NULL) compressedpacketsmessage_ = new ::CompressedPacketsMessage;
+  return compressedpacketsmessage_;
+}
+inline ::CompressedPacketsMessage* PokerTHMessage::release_compressedpacketsmessage() {
+  clear_has_compressedpacketsmessage();
+  ::CompressedPacketsMessage* temp = compressedpacketsmessage_;
+  compressedpacketsmessage_ = NULL;
+  return temp;
+}
+inline void PokerTHMessage::set_allocated_compressedpacketsmessage(::CompressedPacketsMessage* compressedpacketsmessage) {
+  delete compressedpacketsmessage_;
+  compressedpacketsmessage_ = compressedpacketsmessage;
+  if (compressedpacketsmessage) {
+    set_has_compressedpacketsmessage();
+  } else {
+    clear_has_compressedpacketsmessage();
+  }
+}
+
 
 // @@protoc_insertion_point(namespace_scope)
 
@@ -4801,6 +4801,44 @@ public final class ProtoBuf {
      * </pre>
      */
     com.google.protobuf.ByteString getAvatarHash();
+
+    // optional bool supportsCompression = 9;
+    /**
+     * <code>optional bool supportsCompression = 9;</code>
+     *
+     * <pre>
+     * The client is able to handle CompressedPacketsMessage.
+     * </pre>
+     */
+    boolean hasSupportsCompression();
+    /**
+     * <code>optional bool supportsCompression = 9;</code>
+     *
+     * <pre>
+     * The client is able to handle CompressedPacketsMessage.
+     * </pre>
+     */
+    boolean getSupportsCompression();
+
+    // optional bool acceptsFastForward = 10;
+    /**
+     * <code>optional bool acceptsFastForward = 10;</code>
+     *
+     * <pre>
+     * Hands at tables where this client has no active seat may be played
+     * without delays. Spectators and auto-folded players get them quickly.
+     * </pre>
+     */
+    boolean hasAcceptsFastForward();
+    /**
+     * <code>optional bool acceptsFastForward = 10;</code>
+     *
+     * <pre>
+     * Hands at tables where this client has no active seat may be played
+     * without delays. Spectators and auto-folded players get them quickly.
+     * </pre>
+     */
+    boolean getAcceptsFastForward();
   }
   /**
    * Protobuf type {@code InitMessage}
@@ -4901,6 +4939,16 @@ public final class ProtoBuf {
               avatarHash_ = input.readBytes();
               break;
             }
+            case 72: {
+              bitField0_ |= 0x00000100;
+              supportsCompression_ = input.readBool();
+              break;
+            }
+            case 80: {
+              bitField0_ |= 0x00000200;
+              acceptsFastForward_ = input.readBool();
+              break;
+            }
           }
         }
       } catch (com.google.protobuf.InvalidProtocolBufferException e) {
@@ -5203,6 +5251,56 @@ public final class ProtoBuf {
       return avatarHash_;
     }
 
+    // optional bool supportsCompression = 9;
+    public static final int SUPPORTSCOMPRESSION_FIELD_NUMBER = 9;
+    private boolean supportsCompression_;
+    /**
+     * <code>optional bool supportsCompression = 9;</code>
+     *
+     * <pre>
+     * The client is able to handle CompressedPacketsMessage.
+     * </pre>
+     */
+    public boolean hasSupportsCompression() {
+      return ((bitField0_ & 0x00000100) == 0x00000100);
+    }
+    /**
+     * <code>optional bool supportsCompression = 9;</code>
+     *
+     * <pre>
+     * The client is able to handle CompressedPacketsMessage.
+     * </pre>
+     */
+    public boolean getSupportsCompression() {
+      return supportsCompression_;
+    }
+
+    // optional bool acceptsFastForward = 10;
+    public static final int ACCEPTSFASTFORWARD_FIELD_NUMBER = 10;
+    private boolean acceptsFastForward_;
+    /**
+     * <code>optional bool acceptsFastForward = 10;</code>
+     *
+     * <pre>
+     * Hands at tables where this client has no active seat may be played
+     * without delays. Spectators and auto-folded players get them quickly.
+     * </pre>
+     */
+    public boolean hasAcceptsFastForward() {
+      return ((bitField0_ & 0x00000200) == 0x00000200);
+    }
+    /**
+     * <code>optional bool acceptsFastForward = 10;</code>
+     *
+     * <pre>
+     * Hands at tables where this client has no active seat may be played
+     * without delays. Spectators and auto-folded players get them quickly.
+     * </pre>
+     */
+    public boolean getAcceptsFastForward() {
+      return acceptsFastForward_;
+    }
+
     private void initFields() {
       requestedVersion_ = de.pokerth.protocol.ProtoBuf.AnnounceMessage.Version.getDefaultInstance();
       buildId_ = 0;
@@ -5212,6 +5310,8 @@ public final class ProtoBuf {
       nickName_ = "";
       clientUserData_ = com.google.protobuf.ByteString.EMPTY;
       avatarHash_ = com.google.protobuf.ByteString.EMPTY;
+      supportsCompression_ = false;
+      acceptsFastForward_ = false;
     }
     private byte memoizedIsInitialized = -1;
     public final boolean isInitialized() {
@@ -5265,6 +5365,12 @@ public final class ProtoBuf {
       if (((bitField0_ & 0x00000080) == 0x00000080)) {
         output.writeBytes(8, avatarHash_);
       }
+      if (((bitField0_ & 0x00000100) == 0x00000100)) {
+        output.writeBool(9, supportsCompression_);
+      }
+      if (((bitField0_ & 0x00000200) == 0x00000200)) {
+        output.writeBool(10, acceptsFastForward_);
+      }
     }
 
     private int memoizedSerializedSize = -1;
@@ -5305,6 +5411,14 @@ public final class ProtoBuf {
         size += com.google.protobuf.CodedOutputStream
           .computeBytesSize(8, avatarHash_);
       }
+      if (((bitField0_ & 0x00000100) == 0x00000100)) {
+        size += com.google.protobuf.CodedOutputStream
+          .computeBoolSize(9, supportsCompression_);
+      }
+      if (((bitField0_ & 0x00000200) == 0x00000200)) {
+        size += com.google.protobuf.CodedOutputStream
+          .computeBoolSize(10, acceptsFastForward_);
+      }
       memoizedSerializedSize = size;
       return size;
     }
@@ -5416,6 +5530,10 @@ public final class ProtoBuf {
         bitField0_ = (bitField0_ & ~0x00000040);
         avatarHash_ = com.google.protobuf.ByteString.EMPTY;
         bitField0_ = (bitField0_ & ~0x00000080);
+        supportsCompression_ = false;
+        bitField0_ = (bitField0_ & ~0x00000100);
+        acceptsFastForward_ = false;
+        bitField0_ = (bitField0_ & ~0x00000200);
         return this;
       }
 
@@ -5471,6 +5589,14 @@ public final class ProtoBuf {
           to_bitField0_ |= 0x00000080;
         }
         result.avatarHash_ = avatarHash_;
+        if (((from_bitField0_ & 0x00000100) == 0x00000100)) {
+          to_bitField0_ |= 0x00000100;
+        }
+        result.supportsCompression_ = supportsCompression_;
+        if (((from_bitField0_ & 0x00000200) == 0x00000200)) {
+          to_bitField0_ |= 0x00000200;
+        }
+        result.acceptsFastForward_ = acceptsFastForward_;
         result.bitField0_ = to_bitField0_;
         return result;
       }
@@ -5505,6 +5631,12 @@ public final class ProtoBuf {
         if (other.hasAvatarHash()) {
           setAvatarHash(other.getAvatarHash());
         }
+        if (other.hasSupportsCompression()) {
+          setSupportsCompression(other.getSupportsCompression());
+        }
+        if (other.hasAcceptsFastForward()) {
+          setAcceptsFastForward(other.getAcceptsFastForward());
+        }
         return this;
       }
 
@@ -5989,397 +6121,499 @@ public final class ProtoBuf {
         return this;
       }
 
-      // @@protoc_insertion_point(builder_scope:InitMessage)
-    }
-
-    static {
-      defaultInstance = new InitMessage(true);
-      defaultInstance.initFields();
-    }
-
-    // @@protoc_insertion_point(class_scope:InitMessage)
-  }
-
-  public interface AuthServerChallengeMessageOrBuilder
-      extends com.google.protobuf.MessageLiteOrBuilder {
-
-    // required bytes serverChallenge = 1;
-    /**
-     * <code>required bytes serverChallenge = 1;</code>
-     */
-    boolean hasServerChallenge();
-    /**
-     * <code>required bytes serverChallenge = 1;</code>
-     */
-    com.google.protobuf.ByteString getServerChallenge();
-  }
-  /**
-   * Protobuf type {@code AuthServerChallengeMessage}
-   */
-  public static final class AuthServerChallengeMessage extends
-      com.google.protobuf.GeneratedMessageLite
-      implements AuthServerChallengeMessageOrBuilder {
-    // Use AuthServerChallengeMessage.newBuilder() to construct.
-    private AuthServerChallengeMessage(com.google.protobuf.GeneratedMessageLite.Builder builder) {
-      super(builder);
-
-    }
-    private AuthServerChallengeMessage(boolean noInit) {}
-
-    private static final AuthServerChallengeMessage defaultInstance;
-    public static AuthServerChallengeMessage getDefaultInstance() {
-      return defaultInstance;
-    }
-
-    public AuthServerChallengeMessage getDefaultInstanceForType() {
-      return defaultInstance;
-    }
-
-    private AuthServerChallengeMessage(
-        com.google.protobuf.CodedInputStream input,
-        com.google.protobuf.ExtensionRegistryLite extensionRegistry)
-        throws com.google.protobuf.InvalidProtocolBufferException {
-      initFields();
-      int mutable_bitField0_ = 0;
-      try {
-        boolean done = false;
-        while (!done) {
-          int tag = input.readTag();
-          switch (tag) {
-            case 0:
-              done = true;
-              break;
-            default: {
-              if (!parseUnknownField(input,
-                                     extensionRegistry, tag)) {
-                done = true;
-              }
-              break;
-            }
-            case 10: {
-              bitField0_ |= 0x00000001;
-              serverChallenge_ = input.readBytes();
-              break;
-            }
-          }
-        }
-      } catch (com.google.protobuf.InvalidProtocolBufferException e) {
-        throw e.setUnfinishedMessage(this);
-      } catch (java.io.IOException e) {
-        throw new com.google.protobuf.InvalidProtocolBufferException(
-            e.getMessage()).setUnfinishedMessage(this);
-      } finally {
-        makeExtensionsImmutable();
-      }
-    }
-    public static com.google.protobuf.Parser<AuthServerChallengeMessage> PARSER =
-        new com.google.protobuf.AbstractParser<AuthServerChallengeMessage>() {
-      public AuthServerChallengeMessage parsePartialFrom(
-          com.google.protobuf.CodedInputStream input,
-          com.google.protobuf.ExtensionRegistryLite extensionRegistry)
-          throws com.google.protobuf.InvalidProtocolBufferException {
-        return new AuthServerChallengeMessage(input, extensionRegistry);
-      }
-    };
-
-    @java.lang.Override
-    public com.google.protobuf.Parser<AuthServerChallengeMessage> getParserForType() {
-      return PARSER;
-    }
-
-    private int bitField0_;
-    // required bytes serverChallenge = 1;
-    public static final int SERVERCHALLENGE_FIELD_NUMBER = 1;
-    private com.google.protobuf.ByteString serverChallenge_;
-    /**
-     * <code>required bytes serverChallenge = 1;</code>
-     */
-    public boolean hasServerChallenge() {
-      return ((bitField0_ & 0x00000001) == 0x00000001);
-    }
-    /**
-     * <code>required bytes serverChallenge = 1;</code>
-     */
-    public com.google.protobuf.ByteString getServerChallenge() {
-      return serverChallenge_;
-    }
-
-    private void initFields() {
-      serverChallenge_ = com.google.protobuf.ByteString.EMPTY;
-    }
-    private byte memoizedIsInitialized = -1;
-    public final boolean isInitialized() {
-      byte isInitialized = memoizedIsInitialized;
-      if (isInitialized != -1) return isInitialized == 1;
-
-      if (!hasServerChallenge()) {
-        memoizedIsInitialized = 0;
-        return false;
-      }
-      memoizedIsInitialized = 1;
-      return true;
-    }
-
-    public void writeTo(com.google.protobuf.CodedOutputStream output)
-                        throws java.io.IOException {
-      getSerializedSize();
-      if (((bitField0_ & 0x00000001) == 0x00000001)) {
-        output.writeBytes(1, serverChallenge_);
-      }
-    }
-
-    private int memoizedSerializedSize = -1;
-    public int getSerializedSize() {
-      int size = memoizedSerializedSize;
-      if (size != -1) return size;
-
-      size = 0;
-      if (((bitField0_ & 0x00000001) == 0x00000001)) {
-        size += com.google.protobuf.CodedOutputStream
-          .computeBytesSize(1, serverChallenge_);
-      }
-      memoizedSerializedSize = size;
-      return size;
-    }
-
-    private static final long serialVersionUID = 0L;
-    @java.lang.Override
-    protected java.lang.Object writeReplace()
-        throws java.io.ObjectStreamException {
-      return super.writeReplace();
-    }
-
-    public static de.pokerth.protocol.ProtoBuf.AuthServerChallengeMessage parseFrom(
-        com.google.protobuf.ByteString data)
-        throws com.google.protobuf.InvalidProtocolBufferException {
-      return PARSER.parseFrom(data);
-    }
-    public static de.pokerth.protocol.ProtoBuf.AuthServerChallengeMessage parseFrom(
-        com.google.protobuf.ByteString data,
-        com.google.protobuf.ExtensionRegistryLite extensionRegistry)
-        throws com.google.protobuf.InvalidProtocolBufferException {
-      return PARSER.parseFrom(data, extensionRegistry);
-    }
-    public static de.pokerth.protocol.ProtoBuf.AuthServerChallengeMessage parseFrom(byte[] data)
-        throws com.google.protobuf.InvalidProtocolBufferException {
-      return PARSER.parseFrom(data);
-    }
-    public static de.pokerth.protocol.ProtoBuf.AuthServerChallengeMessage parseFrom(
-        byte[] data,
-        com.google.protobuf.ExtensionRegistryLite extensionRegistry)
-        throws com.google.protobuf.InvalidProtocolBufferException {
-      return PARSER.parseFrom(data, extensionRegistry);
-    }
-    public static de.pokerth.protocol.ProtoBuf.AuthServerChallengeMessage parseFrom(java.io.InputStream input)
-        throws java.io.IOException {
-      return PARSER.parseFrom(input);
-    }
-    public static de.pokerth.protocol.ProtoBuf.AuthServerChallengeMessage parseFrom(
-        java.io.InputStream input,
-        com.google.protobuf.ExtensionRegistryLite extensionRegistry)
-        throws java.io.IOException {
-      return PARSER.parseFrom(input, extensionRegistry);
-    }
-    public static de.pokerth.protocol.ProtoBuf.AuthServerChallengeMessage parseDelimitedFrom(java.io.InputStream input)
-        throws java.io.IOException {
-      return PARSER.parseDelimitedFrom(input);
-    }
-    public static de.pokerth.protocol.ProtoBuf.AuthServerChallengeMessage parseDelimitedFrom(
-        java.io.InputStream input,
-        com.google.protobuf.ExtensionRegistryLite extensionRegistry)
-        throws java.io.IOException {
-      return PARSER.parseDelimitedFrom(input, extensionRegistry);
-    }
-    public static de.pokerth.protocol.ProtoBuf.AuthServerChallengeMessage parseFrom(
-        com.google.protobuf.CodedInputStream input)
-        throws java.io.IOException {
-      return PARSER.parseFrom(input);
-    }
-    public static de.pokerth.protocol.ProtoBuf.AuthServerChallengeMessage parseFrom(
-        com.google.protobuf.CodedInputStream input,
-        com.google.protobuf.ExtensionRegistryLite extensionRegistry)
-        throws java.io.IOException {
-      return PARSER.parseFrom(input, extensionRegistry);
-    }
-
-    public static Builder newBuilder() { return Builder.create(); }
-    public Builder newBuilderForType() { return newBuilder(); }
-    public static Builder newBuilder(de.pokerth.protocol.ProtoBuf.AuthServerChallengeMessage prototype) {
-      return newBuilder().mergeFrom(prototype);
-    }
-    public Builder toBuilder() { return newBuilder(this); }
-
-    /**
-     * Protobuf type {@code AuthServerChallengeMessage}
-     */
-    public static final class Builder extends
-        com.google.protobuf.GeneratedMessageLite.Builder<
-          de.pokerth.protocol.ProtoBuf.AuthServerChallengeMessage, Builder>
-        implements de.pokerth.protocol.ProtoBuf.AuthServerChallengeMessageOrBuilder {
-      // Construct using de.pokerth.protocol.ProtoBuf.AuthServerChallengeMessage.newBuilder()
-      private Builder() {
-        maybeForceBuilderInitialization();
-      }
-
-      private void maybeForceBuilderInitialization() {
-      }
-      private static Builder create() {
-        return new Builder();
-      }
-
-      public Builder clear() {
-        super.clear();
-        serverChallenge_ = com.google.protobuf.ByteString.EMPTY;
-        bitField0_ = (bitField0_ & ~0x00000001);
-        return this;
-      }
-
-      public Builder clone() {
-        return create().mergeFrom(buildPartial());
-      }
-
-      public de.pokerth.protocol.ProtoBuf.AuthServerChallengeMessage getDefaultInstanceForType() {
-        return de.pokerth.protocol.ProtoBuf.AuthServerChallengeMessage.getDefaultInstance();
-      }
-
-      public de.pokerth.protocol.ProtoBuf.AuthServerChallengeMessage build() {
-        de.pokerth.protocol.ProtoBuf.AuthServerChallengeMessage result = buildPartial();
-        if (!result.isInitialized()) {
-          throw newUninitializedMessageException(result);
-        }
-        return result;
+      // optional bool supportsCompression = 9;
+      private boolean supportsCompression_ ;
+      /**
+       * <code>optional bool supportsCompression = 9;</code>
+       *
+       * <pre>
+       * The client is able to handle CompressedPacketsMessage.
+       * </pre>
+       */
+      public boolean hasSupportsCompression() {
+        return ((bitField0_ & 0x00000100) == 0x00000100);
       }
-
-      public de.pokerth.protocol.ProtoBuf.AuthServerChallengeMessage buildPartial() {
-        de.pokerth.protocol.ProtoBuf.AuthServerChallengeMessage result = new de.pokerth.protocol.ProtoBuf.AuthServerChallengeMessage(this);
-        int from_bitField0_ = bitField0_;
-        int to_bitField0_ = 0;
-        if (((from_bitField0_ & 0x00000001) == 0x00000001)) {
-          to_bitField0_ |= 0x00000001;
-        }
-        result.serverChallenge_ = serverChallenge_;
-        result.bitField0_ = to_bitField0_;
-        return result;
+      /**
+       * <code>optional bool supportsCompression = 9;</code>
+       *
+       * <pre>
+       * The client is able to handle CompressedPacketsMessage.
+       * </pre>
+       */
+      public boolean getSupportsCompression() {
+        return supportsCompression_;
       }
-
-      public Builder mergeFrom(de.pokerth.protocol.ProtoBuf.AuthServerChallengeMessage other) {
-        if (other == de.pokerth.protocol.ProtoBuf.AuthServerChallengeMessage.getDefaultInstance()) return this;
-        if (other.hasServerChallenge()) {
-          setServerChallenge(other.getServerChallenge());
-        }
+      /**
+       * <code>optional bool supportsCompression = 9;</code>
+       *
+       * <pre>
+       * The client is able to handle CompressedPacketsMessage.
+       * </pre>
+       */
+      public Builder setSupportsCompression(boolean value) {
+        bitField0_ |= 0x00000100;
+        supportsCompression_ = value;
+        
         return this;
       }
-
-      public final boolean isInitialized() {
-        if (!hasServerChallenge()) {
-          
-          return false;
-        }
-        return true;
-      }
-
-      public Builder mergeFrom(
-          com.google.protobuf.CodedInputStream input,
-          com.google.protobuf.ExtensionRegistryLite extensionRegistry)
-          throws java.io.IOException {
-        de.pokerth.protocol.ProtoBuf.AuthServerChallengeMessage parsedMessage = null;
-        try {
-          parsedMessage = PARSER.parsePartialFrom(input, extensionRegistry);
-        } catch (com.google.protobuf.InvalidProtocolBufferException e) {
-          parsedMessage = (de.pokerth.protocol.ProtoBuf.AuthServerChallengeMessage) e.getUnfinishedMessage();
-          throw e;
-        } finally {
-          if (parsedMessage != null) {
-            mergeFrom(parsedMessage);
-          }
-        }
+      /**
+       * <code>optional bool supportsCompression = 9;</code>
+       *
+       * <pre>
+       * The client is able to handle CompressedPacketsMessage.
+       * </pre>
+       */
+      public Builder clearSupportsCompression() {
+        bitField0_ = (bitField0_ & ~0x00000100);
+        supportsCompression_ = false;
+        
         return this;
       }
-      private int bitField0_;
 
-      // required bytes serverChallenge = 1;
-      private com.google.protobuf.ByteString serverChallenge_ = com.google.protobuf.ByteString.EMPTY;
+      // optional bool acceptsFastForward = 10;
+      private boolean acceptsFastForward_ ;
       /**
-       * <code>required bytes serverChallenge = 1;</code>
+       * <code>optional bool acceptsFastForward = 10;</code>
+       *
+       * <pre>
+       * Hands at tables where this client has no active seat may be played
+       * without delays. Spectators and auto-folded players get them quickly.
+       * </pre>
        */
-      public boolean hasServerChallenge() {
-        return ((bitField0_ & 0x00000001) == 0x00000001);
+      public boolean hasAcceptsFastForward() {
+        return ((bitField0_ & 0x00000200) == 0x00000200);
       }
       /**
-       * <code>required bytes serverChallenge = 1;</code>
+       * <code>optional bool acceptsFastForward = 10;</code>
+       *
+       * <pre>
+       * Hands at tables where this client has no active seat may be played
+       * without delays. Spectators and auto-folded players get them quickly.
+       * </pre>
        */
-      public com.google.protobuf.ByteString getServerChallenge() {
-        return serverChallenge_;
+      public boolean getAcceptsFastForward() {
+        return acceptsFastForward_;
       }
       /**
-       * <code>required bytes serverChallenge = 1;</code>
+       * <code>optional bool acceptsFastForward = 10;</code>
+       *
+       * <pre>
+       * Hands at tables where this client has no active seat may be played
+       * without delays. Spectators and auto-folded players get them quickly.
+       * </pre>
        */
-      public Builder setServerChallenge(com.google.protobuf.ByteString value) {
-        if (value == null) {
-    throw new NullPointerException();
-  }
-  bitField0_ |= 0x00000001;
-        serverChallenge_ = value;
+      public Builder setAcceptsFastForward(boolean value) {
+        bitField0_ |= 0x00000200;
+        acceptsFastForward_ = value;
         
         return this;
       }
       /**
-       * <code>required bytes serverChallenge = 1;</code>
+       * <code>optional bool acceptsFastForward = 10;</code>
+       *
+       * <pre>
+       * Hands at tables where this client has no active seat may be played
+       * without delays. Spectators and auto-folded players get them quickly.
+       * </pre>
        */
-      public Builder clearServerChallenge() {
-        bitField0_ = (bitField0_ & ~0x00000001);
-        serverChallenge_ = getDefaultInstance().getServerChallenge();
+      public Builder clearAcceptsFastForward() {
+        bitField0_ = (bitField0_ & ~0x00000200);
+        acceptsFastForward_ = false;
         
         return this;
       }
 
-      // @@protoc_insertion_point(builder_scope:AuthServerChallengeMessage)
+      // @@protoc_insertion_point(builder_scope:InitMessage)
     }
 
     static {
-      defaultInstance = new AuthServerChallengeMessage(true);
+      defaultInstance = new InitMessage(true);
       defaultInstance.initFields();
     }
 
-    // @@protoc_insertion_point(class_scope:AuthServerChallengeMessage)
+    // @@protoc_insertion_point(class_scope:InitMessage)
   }
 
-  public interface AuthClientResponseMessageOrBuilder
+  public interface AuthServerChallengeMessageOrBuilder
       extends com.google.protobuf.MessageLiteOrBuilder {
 
-    // required bytes clientResponse = 1;
+    // required bytes serverChallenge = 1;
     /**
-     * <code>required bytes clientResponse = 1;</code>
+     * <code>required bytes serverChallenge = 1;</code>
      */
-    boolean hasClientResponse();
+    boolean hasServerChallenge();
     /**
-     * <code>required bytes clientResponse = 1;</code>
+     * <code>required bytes serverChallenge = 1;</code>
      */
-    com.google.protobuf.ByteString getClientResponse();
+    com.google.protobuf.ByteString getServerChallenge();
   }
   /**
-   * Protobuf type {@code AuthClientResponseMessage}
+   * Protobuf type {@code AuthServerChallengeMessage}
    */
-  public static final class AuthClientResponseMessage extends
+  public static final class AuthServerChallengeMessage extends
       com.google.protobuf.GeneratedMessageLite
-      implements AuthClientResponseMessageOrBuilder {
-    // Use AuthClientResponseMessage.newBuilder() to construct.
-    private AuthClientResponseMessage(com.google.protobuf.GeneratedMessageLite.Builder builder) {
+      implements AuthServerChallengeMessageOrBuilder {
+    // Use AuthServerChallengeMessage.newBuilder() to construct.
+    private AuthServerChallengeMessage(com.google.protobuf.GeneratedMessageLite.Builder builder) {
       super(builder);
 
     }
-    private AuthClientResponseMessage(boolean noInit) {}
+    private AuthServerChallengeMessage(boolean noInit) {}
 
-    private static final AuthClientResponseMessage defaultInstance;
-    public static AuthClientResponseMessage getDefaultInstance() {
+    private static final AuthServerChallengeMessage defaultInstance;
+    public static AuthServerChallengeMessage getDefaultInstance() {
       return defaultInstance;
     }
 
-    public AuthClientResponseMessage getDefaultInstanceForType() {
+    public AuthServerChallengeMessage getDefaultInstanceForType() {
       return defaultInstance;
     }
 
-    private AuthClientResponseMessage(
+    private AuthServerChallengeMessage(
+        com.google.protobuf.CodedInputStream input,
+        com.google.protobuf.ExtensionRegistryLite extensionRegistry)
+        throws com.google.protobuf.InvalidProtocolBufferException {
+      initFields();
+      int mutable_bitField0_ = 0;
+      try {
+        boolean done = false;
+        while (!done) {
+          int tag = input.readTag();
+          switch (tag) {
+            case 0:
+              done = true;
+              break;
+            default: {
+              if (!parseUnknownField(input,
+                                     extensionRegistry, tag)) {
+                done = true;
+              }
+              break;
+            }
+            case 10: {
+              bitField0_ |= 0x00000001;
+              serverChallenge_ = input.readBytes();
+              break;
+            }
+          }
+        }
+      } catch (com.google.protobuf.InvalidProtocolBufferException e) {
+        throw e.setUnfinishedMessage(this);
+      } catch (java.io.IOException e) {
+        throw new com.google.protobuf.InvalidProtocolBufferException(
+            e.getMessage()).setUnfinishedMessage(this);
+      } finally {
+        makeExtensionsImmutable();
+      }
+    }
+    public static com.google.protobuf.Parser<AuthServerChallengeMessage> PARSER =
+        new com.google.protobuf.AbstractParser<AuthServerChallengeMessage>() {
+      public AuthServerChallengeMessage parsePartialFrom(
+          com.google.protobuf.CodedInputStream input,
+          com.google.protobuf.ExtensionRegistryLite extensionRegistry)
+          throws com.google.protobuf.InvalidProtocolBufferException {
+        return new AuthServerChallengeMessage(input, extensionRegistry);
+      }
+    };
+
+    @java.lang.Override
+    public com.google.protobuf.Parser<AuthServerChallengeMessage> getParserForType() {
+      return PARSER;
+    }
+
+    private int bitField0_;
+    // required bytes serverChallenge = 1;
+    public static final int SERVERCHALLENGE_FIELD_NUMBER = 1;
+    private com.google.protobuf.ByteString serverChallenge_;
+    /**
+     * <code>required bytes serverChallenge = 1;</code>
+     */
+    public boolean hasServerChallenge() {
+      return ((bitField0_ & 0x00000001) == 0x00000001);
+    }
+    /**
+     * <code>required bytes serverChallenge = 1;</code>
+     */
+    public com.google.protobuf.ByteString getServerChallenge() {
+      return serverChallenge_;
+    }
+
+    private void initFields() {
+      serverChallenge_ = com.google.protobuf.ByteString.EMPTY;
+    }
+    private byte memoizedIsInitialized = -1;
+    public final boolean isInitialized() {
+      byte isInitialized = memoizedIsInitialized;
+      if (isInitialized != -1) return isInitialized == 1;
+
+      if (!hasServerChallenge()) {
+        memoizedIsInitialized = 0;
+        return false;
+      }
+      memoizedIsInitialized = 1;
+      return true;
+    }
+
+    public void writeTo(com.google.protobuf.CodedOutputStream output)
+                        throws java.io.IOException {
+      getSerializedSize();
+      if (((bitField0_ & 0x00000001) == 0x00000001)) {
+        output.writeBytes(1, serverChallenge_);
+      }
+    }
+
+    private int memoizedSerializedSize = -1;
+    public int getSerializedSize() {
+      int size = memoizedSerializedSize;
+      if (size != -1) return size;
+
+      size = 0;
+      if (((bitField0_ & 0x00000001) == 0x00000001)) {
+        size += com.google.protobuf.CodedOutputStream
+          .computeBytesSize(1, serverChallenge_);
+      }
+      memoizedSerializedSize = size;
+      return size;
+    }
+
+    private static final long serialVersionUID = 0L;
+    @java.lang.Override
+    protected java.lang.Object writeReplace()
+        throws java.io.ObjectStreamException {
+      return super.writeReplace();
+    }
+
+    public static de.pokerth.protocol.ProtoBuf.AuthServerChallengeMessage parseFrom(
+        com.google.protobuf.ByteString data)
+        throws com.google.protobuf.InvalidProtocolBufferException {
+      return PARSER.parseFrom(data);
+    }
+    public static de.pokerth.protocol.ProtoBuf.AuthServerChallengeMessage parseFrom(
+        com.google.protobuf.ByteString data,
+        com.google.protobuf.ExtensionRegistryLite extensionRegistry)
+        throws com.google.protobuf.InvalidProtocolBufferException {
+      return PARSER.parseFrom(data, extensionRegistry);
+    }
+    public static de.pokerth.protocol.ProtoBuf.AuthServerChallengeMessage parseFrom(byte[] data)
+        throws com.google.protobuf.InvalidProtocolBufferException {
+      return PARSER.parseFrom(data);
+    }
+    public static de.pokerth.protocol.ProtoBuf.AuthServerChallengeMessage parseFrom(
+        byte[] data,
+        com.google.protobuf.ExtensionRegistryLite extensionRegistry)
+        throws com.google.protobuf.InvalidProtocolBufferException {
+      return PARSER.parseFrom(data, extensionRegistry);
+    }
+    public static de.pokerth.protocol.ProtoBuf.AuthServerChallengeMessage parseFrom(java.io.InputStream input)
+        throws java.io.IOException {
+      return PARSER.parseFrom(input);
+    }
+    public static de.pokerth.protocol.ProtoBuf.AuthServerChallengeMessage parseFrom(
+        java.io.InputStream input,
+        com.google.protobuf.ExtensionRegistryLite extensionRegistry)
+        throws java.io.IOException {
+      return PARSER.parseFrom(input, extensionRegistry);
+    }
+    public static de.pokerth.protocol.ProtoBuf.AuthServerChallengeMessage parseDelimitedFrom(java.io.InputStream input)
+        throws java.io.IOException {
+      return PARSER.parseDelimitedFrom(input);
+    }
+    public static de.pokerth.protocol.ProtoBuf.AuthServerChallengeMessage parseDelimitedFrom(
+        java.io.InputStream input,
+        com.google.protobuf.ExtensionRegistryLite extensionRegistry)
+        throws java.io.IOException {
+      return PARSER.parseDelimitedFrom(input, extensionRegistry);
+    }
+    public static de.pokerth.protocol.ProtoBuf.AuthServerChallengeMessage parseFrom(
+        com.google.protobuf.CodedInputStream input)
+        throws java.io.IOException {
+      return PARSER.parseFrom(input);
+    }
+    public static de.pokerth.protocol.ProtoBuf.AuthServerChallengeMessage parseFrom(
+        com.google.protobuf.CodedInputStream input,
+        com.google.protobuf.ExtensionRegistryLite extensionRegistry)
+        throws java.io.IOException {
+      return PARSER.parseFrom(input, extensionRegistry);
+    }
+
+    public static Builder newBuilder() { return Builder.create(); }
+    public Builder newBuilderForType() { return newBuilder(); }
+    public static Builder newBuilder(de.pokerth.protocol.ProtoBuf.AuthServerChallengeMessage prototype) {
+      return newBuilder().mergeFrom(prototype);
+    }
+    public Builder toBuilder() { return newBuilder(this); }
+
+    /**
+     * Protobuf type {@code AuthServerChallengeMessage}
+     */
+    public static final class Builder extends
+        com.google.protobuf.GeneratedMessageLite.Builder<
+          de.pokerth.protocol.ProtoBuf.AuthServerChallengeMessage, Builder>
+        implements de.pokerth.protocol.ProtoBuf.AuthServerChallengeMessageOrBuilder {
+      // Construct using de.pokerth.protocol.ProtoBuf.AuthServerChallengeMessage.newBuilder()
+      private Builder() {
+        maybeForceBuilderInitialization();
+      }
+
+      private void maybeForceBuilderInitialization() {
+      }
+      private static Builder create() {
+        return new Builder();
+      }
+
+      public Builder clear() {
+        super.clear();
+        serverChallenge_ = com.google.protobuf.ByteString.EMPTY;
+        bitField0_ = (bitField0_ & ~0x00000001);
+        return this;
+      }
+
+      public Builder clone() {
+        return create().mergeFrom(buildPartial());
+      }
+
+      public de.pokerth.protocol.ProtoBuf.AuthServerChallengeMessage getDefaultInstanceForType() {
+        return de.pokerth.protocol.ProtoBuf.AuthServerChallengeMessage.getDefaultInstance();
+      }
+
+      public de.pokerth.protocol.ProtoBuf.AuthServerChallengeMessage build() {
+        de.pokerth.protocol.ProtoBuf.AuthServerChallengeMessage result = buildPartial();
+        if (!result.isInitialized()) {
+          throw newUninitializedMessageException(result);
+        }
+        return result;
+      }
+
+      public de.pokerth.protocol.ProtoBuf.AuthServerChallengeMessage buildPartial() {
+        de.pokerth.protocol.ProtoBuf.AuthServerChallengeMessage result = new de.pokerth.protocol.ProtoBuf.AuthServerChallengeMessage(this);
+        int from_bitField0_ = bitField0_;
+        int to_bitField0_ = 0;
+        if (((from_bitField0_ & 0x00000001) == 0x00000001)) {
+          to_bitField0_ |= 0x00000001;
+        }
+        result.serverChallenge_ = serverChallenge_;
+        result.bitField0_ = to_bitField0_;
+        return result;
+      }
+
+      public Builder mergeFrom(de.pokerth.protocol.ProtoBuf.AuthServerChallengeMessage other) {
+        if (other == de.pokerth.protocol.ProtoBuf.AuthServerChallengeMessage.getDefaultInstance()) return this;
+        if (other.hasServerChallenge()) {
+          setServerChallenge(other.getServerChallenge());
+        }
+        return this;
+      }
+
+      public final boolean isInitialized() {
+        if (!hasServerChallenge()) {
+          
+          return false;
+        }
+        return true;
+      }
+
+      public Builder mergeFrom(
+          com.google.protobuf.CodedInputStream input,
+          com.google.protobuf.ExtensionRegistryLite extensionRegistry)
+          throws java.io.IOException {
+        de.pokerth.protocol.ProtoBuf.AuthServerChallengeMessage parsedMessage = null;
+        try {
+          parsedMessage = PARSER.parsePartialFrom(input, extensionRegistry);
+        } catch (com.google.protobuf.InvalidProtocolBufferException e) {
+          parsedMessage = (de.pokerth.protocol.ProtoBuf.AuthServerChallengeMessage) e.getUnfinishedMessage();
+          throw e;
+        } finally {
+          if (parsedMessage != null) {
+            mergeFrom(parsedMessage);
+          }
+        }
+        return this;
+      }
+      private int bitField0_;
+
+      // required bytes serverChallenge = 1;
+      private com.google.protobuf.ByteString serverChallenge_ = com.google.protobuf.ByteString.EMPTY;
+      /**
+       * <code>required bytes serverChallenge = 1;</code>
+       */
+      public boolean hasServerChallenge() {
+        return ((bitField0_ & 0x00000001) == 0x00000001);
+      }
+      /**
+       * <code>required bytes serverChallenge = 1;</code>
+       */
+      public com.google.protobuf.ByteString getServerChallenge() {
+        return serverChallenge_;
+      }
+      /**
+       * <code>required bytes serverChallenge = 1;</code>
+       */
+      public Builder setServerChallenge(com.google.protobuf.ByteString value) {
+        if (value == null) {
+    throw new NullPointerException();
+  }
+  bitField0_ |= 0x00000001;
+        serverChallenge_ = value;
+        
+        return this;
+      }
+      /**
+       * <code>required bytes serverChallenge = 1;</code>
+       */
+      public Builder clearServerChallenge() {
+        bitField0_ = (bitField0_ & ~0x00000001);
+        serverChallenge_ = getDefaultInstance().getServerChallenge();
+        
+        return this;
+      }
+
+      // @@protoc_insertion_point(builder_scope:AuthServerChallengeMessage)
+    }
+
+    static {
+      defaultInstance = new AuthServerChallengeMessage(true);
+      defaultInstance.initFields();
+    }
+
+    // @@protoc_insertion_point(class_scope:AuthServerChallengeMessage)
+  }
+
+  public interface AuthClientResponseMessageOrBuilder
+      extends com.google.protobuf.MessageLiteOrBuilder {
+
+    // required bytes clientResponse = 1;
+    /**
+     * <code>required bytes clientResponse = 1;</code>
+     */
+    boolean hasClientResponse();
+    /**
+     * <code>required bytes clientResponse = 1;</code>
+     */
+    com.google.protobuf.ByteString getClientResponse();
+  }
+  /**
+   * Protobuf type {@code AuthClientResponseMessage}
+   */
+  public static final class AuthClientResponseMessage extends
+      com.google.protobuf.GeneratedMessageLite
+      implements AuthClientResponseMessageOrBuilder {
+    // Use AuthClientResponseMessage.newBuilder() to construct.
+    private AuthClientResponseMessage(com.google.protobuf.GeneratedMessageLite.Builder builder) {
+      super(builder);
+
+    }
+    private AuthClientResponseMessage(boolean noInit) {}
+
+    private static final AuthClientResponseMessage defaultInstance;
+    public static AuthClientResponseMessage getDefaultInstance() {
+      return defaultInstance;
+    }
+
+    public AuthClientResponseMessage getDefaultInstanceForType() {
+      return defaultInstance;
+    }
+
+    private AuthClientResponseMessage(
         com.google.protobuf.CodedInputStream input,
         com.google.protobuf.ExtensionRegistryLite extensionRegistry)
         throws com.google.protobuf.InvalidProtocolBufferException {
@@ -11279,6 +11513,646 @@ public final class ProtoBuf {
     // @@protoc_insertion_point(class_scope:GameListNewMessage)
   }
 
+  public interface LobbySnapshotMessageOrBuilder
+      extends com.google.protobuf.MessageLiteOrBuilder {
+
+    // repeated uint32 playerIds = 1 [packed = true];
+    /**
+     * <code>repeated uint32 playerIds = 1 [packed = true];</code>
+     */
+    java.util.List<java.lang.Integer> getPlayerIdsList();
+    /**
+     * <code>repeated uint32 playerIds = 1 [packed = true];</code>
+     */
+    int getPlayerIdsCount();
+    /**
+     * <code>repeated uint32 playerIds = 1 [packed = true];</code>
+     */
+    int getPlayerIds(int index);
+
+    // repeated .GameListNewMessage games = 2;
+    /**
+     * <code>repeated .GameListNewMessage games = 2;</code>
+     */
+    java.util.List<de.pokerth.protocol.ProtoBuf.GameListNewMessage> 
+        getGamesList();
+    /**
+     * <code>repeated .GameListNewMessage games = 2;</code>
+     */
+    de.pokerth.protocol.ProtoBuf.GameListNewMessage getGames(int index);
+    /**
+     * <code>repeated .GameListNewMessage games = 2;</code>
+     */
+    int getGamesCount();
+  }
+  /**
+   * Protobuf type {@code LobbySnapshotMessage}
+   */
+  public static final class LobbySnapshotMessage extends
+      com.google.protobuf.GeneratedMessageLite
+      implements LobbySnapshotMessageOrBuilder {
+    // Use LobbySnapshotMessage.newBuilder() to construct.
+    private LobbySnapshotMessage(com.google.protobuf.GeneratedMessageLite.Builder builder) {
+      super(builder);
+
+    }
+    private LobbySnapshotMessage(boolean noInit) {}
+
+    private static final LobbySnapshotMessage defaultInstance;
+    public static LobbySnapshotMessage getDefaultInstance() {
+      return defaultInstance;
+    }
+
+    public LobbySnapshotMessage getDefaultInstanceForType() {
+      return defaultInstance;
+    }
+
+    private LobbySnapshotMessage(
+        com.google.protobuf.CodedInputStream input,
+        com.google.protobuf.ExtensionRegistryLite extensionRegistry)
+        throws com.google.protobuf.InvalidProtocolBufferException {
+      initFields();
+      int mutable_bitField0_ = 0;
+      try {
+        boolean done = false;
+        while (!done) {
+          int tag = input.readTag();
+          switch (tag) {
+            case 0:
+              done = true;
+              break;
+            default: {
+              if (!parseUnknownField(input,
+                                     extensionRegistry, tag)) {
+                done = true;
+              }
+              break;
+            }
+            case 8: {
+              if (!((mutable_bitField0_ & 0x00000001) == 0x00000001)) {
+                playerIds_ = new java.util.ArrayList<java.lang.Integer>();
+                mutable_bitField0_ |= 0x00000001;
+              }
+              playerIds_.add(input.readUInt32());
+              break;
+            }
+            case 10: {
+              int length = input.readRawVarint32();
+              int limit = input.pushLimit(length);
+              if (!((mutable_bitField0_ & 0x00000001) == 0x00000001) && input.getBytesUntilLimit() > 0) {
+                playerIds_ = new java.util.ArrayList<java.lang.Integer>();
+                mutable_bitField0_ |= 0x00000001;
+              }
+              while (input.getBytesUntilLimit() > 0) {
+                playerIds_.add(input.readUInt32());
+              }
+              input.popLimit(limit);
+              break;
+            }
+            case 18: {
+              if (!((mutable_bitField0_ & 0x00000002) == 0x00000002)) {
+                games_ = new java.util.ArrayList<de.pokerth.protocol.ProtoBuf.GameListNewMessage>();
+                mutable_bitField0_ |= 0x00000002;
+              }
+              games_.add(input.readMessage(de.pokerth.protocol.ProtoBuf.GameListNewMessage.PARSER, extensionRegistry));
+              break;
+            }
+          }
+        }
+      } catch (com.google.protobuf.InvalidProtocolBufferException e) {
+        throw e.setUnfinishedMessage(this);
+      } catch (java.io.IOException e) {
+        throw new com.google.protobuf.InvalidProtocolBufferException(
+            e.getMessage()).setUnfinishedMessage(this);
+      } finally {
+        if (((mutable_bitField0_ & 0x00000001) == 0x00000001)) {
+          playerIds_ = java.util.Collections.unmodifiableList(playerIds_);
+        }
+        if (((mutable_bitField0_ & 0x00000002) == 0x00000002)) {
+          games_ = java.util.Collections.unmodifiableList(games_);
+        }
+        makeExtensionsImmutable();
+      }
+    }
+    public static com.google.protobuf.Parser<LobbySnapshotMessage> PARSER =
+        new com.google.protobuf.AbstractParser<LobbySnapshotMessage>() {
+      public LobbySnapshotMessage parsePartialFrom(
+          com.google.protobuf.CodedInputStream input,
+          com.google.protobuf.ExtensionRegistryLite extensionRegistry)
+          throws com.google.protobuf.InvalidProtocolBufferException {
+        return new LobbySnapshotMessage(input, extensionRegistry);
+      }
+    };
+
+    @java.lang.Override
+    public com.google.protobuf.Parser<LobbySnapshotMessage> getParserForType() {
+      return PARSER;
+    }
+
+    // repeated uint32 playerIds = 1 [packed = true];
+    public static final int PLAYERIDS_FIELD_NUMBER = 1;
+    private java.util.List<java.lang.Integer> playerIds_;
+    /**
+     * <code>repeated uint32 playerIds = 1 [packed = true];</code>
+     */
+    public java.util.List<java.lang.Integer>
+        getPlayerIdsList() {
+      return playerIds_;
+    }
+    /**
+     * <code>repeated uint32 playerIds = 1 [packed = true];</code>
+     */
+    public int getPlayerIdsCount() {
+      return playerIds_.size();
+    }
+    /**
+     * <code>repeated uint32 playerIds = 1 [packed = true];</code>
+     */
+    public int getPlayerIds(int index) {
+      return playerIds_.get(index);
+    }
+    private int playerIdsMemoizedSerializedSize = -1;
+
+    // repeated .GameListNewMessage games = 2;
+    public static final int GAMES_FIELD_NUMBER = 2;
+    private java.util.List<de.pokerth.protocol.ProtoBuf.GameListNewMessage> games_;
+    /**
+     * <code>repeated .GameListNewMessage games = 2;</code>
+     */
+    public java.util.List<de.pokerth.protocol.ProtoBuf.GameListNewMessage> getGamesList() {
+      return games_;
+    }
+    /**
+     * <code>repeated .GameListNewMessage games = 2;</code>
+     */
+    public java.util.List<? extends de.pokerth.protocol.ProtoBuf.GameListNewMessageOrBuilder> 
+        getGamesOrBuilderList() {
+      return games_;
+    }
+    /**
+     * <code>repeated .GameListNewMessage games = 2;</code>
+     */
+    public int getGamesCount() {
+      return games_.size();
+    }
+    /**
+     * <code>repeated .GameListNewMessage games = 2;</code>
+     */
+    public de.pokerth.protocol.ProtoBuf.GameListNewMessage getGames(int index) {
+      return games_.get(index);
+    }
+    /**
+     * <code>repeated .GameListNewMessage games = 2;</code>
+     */
+    public de.pokerth.protocol.ProtoBuf.GameListNewMessageOrBuilder getGamesOrBuilder(
+        int index) {
+      return games_.get(index);
+    }
+
+    private void initFields() {
+      playerIds_ = java.util.Collections.emptyList();
+      games_ = java.util.Collections.emptyList();
+    }
+    private byte memoizedIsInitialized = -1;
+    public final boolean isInitialized() {
+      byte isInitialized = memoizedIsInitialized;
+      if (isInitialized != -1) return isInitialized == 1;
+
+      for (int i = 0; i < getGamesCount(); i++) {
+        if (!getGames(i).isInitialized()) {
+          memoizedIsInitialized = 0;
+          return false;
+        }
+      }
+      memoizedIsInitialized = 1;
+      return true;
+    }
+
+    public void writeTo(com.google.protobuf.CodedOutputStream output)
+                        throws java.io.IOException {
+      getSerializedSize();
+      if (getPlayerIdsList().size() > 0) {
+        output.writeRawVarint32(10);
+        output.writeRawVarint32(playerIdsMemoizedSerializedSize);
+      }
+      for (int i = 0; i < playerIds_.size(); i++) {
+        output.writeUInt32NoTag(playerIds_.get(i));
+      }
+      for (int i = 0; i < games_.size(); i++) {
+        output.writeMessage(2, games_.get(i));
+      }
+    }
+
+    private int memoizedSerializedSize = -1;
+    public int getSerializedSize() {
+      int size = memoizedSerializedSize;
+      if (size != -1) return size;
+
+      size = 0;
+      {
+        int dataSize = 0;
+        for (int i = 0; i < playerIds_.size(); i++) {
+          dataSize += com.google.protobuf.CodedOutputStream
+            .computeUInt32SizeNoTag(playerIds_.get(i));
+        }
+        size += dataSize;
+        if (!getPlayerIdsList().isEmpty()) {
+          size += 1;
+          size += com.google.protobuf.CodedOutputStream
+              .computeInt32SizeNoTag(dataSize);
+        }
+        playerIdsMemoizedSerializedSize = dataSize;
+      }
+      for (int i = 0; i < games_.size(); i++) {
+        size += com.google.protobuf.CodedOutputStream
+          .computeMessageSize(2, games_.get(i));
+      }
+      memoizedSerializedSize = size;
+      return size;
+    }
+
+    private static final long serialVersionUID = 0L;
+    @java.lang.Override
+    protected java.lang.Object writeReplace()
+        throws java.io.ObjectStreamException {
+      return super.writeReplace();
+    }
+
+    public static de.pokerth.protocol.ProtoBuf.LobbySnapshotMessage parseFrom(
+        com.google.protobuf.ByteString data)
+        throws com.google.protobuf.InvalidProtocolBufferException {
+      return PARSER.parseFrom(data);
+    }
+    public static de.pokerth.protocol.ProtoBuf.LobbySnapshotMessage parseFrom(
+        com.google.protobuf.ByteString data,
+        com.google.protobuf.ExtensionRegistryLite extensionRegistry)
+        throws com.google.protobuf.InvalidProtocolBufferException {
+      return PARSER.parseFrom(data, extensionRegistry);
+    }
+    public static de.pokerth.protocol.ProtoBuf.LobbySnapshotMessage parseFrom(byte[] data)
+        throws com.google.protobuf.InvalidProtocolBufferException {
+      return PARSER.parseFrom(data);
+    }
+    public static de.pokerth.protocol.ProtoBuf.LobbySnapshotMessage parseFrom(
+        byte[] data,
+        com.google.protobuf.ExtensionRegistryLite extensionRegistry)
+        throws com.google.protobuf.InvalidProtocolBufferException {
+      return PARSER.parseFrom(data, extensionRegistry);
+    }
+    public static de.pokerth.protocol.ProtoBuf.LobbySnapshotMessage parseFrom(java.io.InputStream input)
+        throws java.io.IOException {
+      return PARSER.parseFrom(input);
+    }
+    public static de.pokerth.protocol.ProtoBuf.LobbySnapshotMessage parseFrom(
+        java.io.InputStream input,
+        com.google.protobuf.ExtensionRegistryLite extensionRegistry)
+        throws java.io.IOException {
+      return PARSER.parseFrom(input, extensionRegistry);
+    }
+    public static de.pokerth.protocol.ProtoBuf.LobbySnapshotMessage parseDelimitedFrom(java.io.InputStream input)
+        throws java.io.IOException {
+      return PARSER.parseDelimitedFrom(input);
+    }
+    public static de.pokerth.protocol.ProtoBuf.LobbySnapshotMessage parseDelimitedFrom(
+        java.io.InputStream input,
+        com.google.protobuf.ExtensionRegistryLite extensionRegistry)
+        throws java.io.IOException {
+      return PARSER.parseDelimitedFrom(input, extensionRegistry);
+    }
+    public static de.pokerth.protocol.ProtoBuf.LobbySnapshotMessage parseFrom(
+        com.google.protobuf.CodedInputStream input)
+        throws java.io.IOException {
+      return PARSER.parseFrom(input);
+    }
+    public static de.pokerth.protocol.ProtoBuf.LobbySnapshotMessage parseFrom(
+        com.google.protobuf.CodedInputStream input,
+        com.google.protobuf.ExtensionRegistryLite extensionRegistry)
+        throws java.io.IOException {
+      return PARSER.parseFrom(input, extensionRegistry);
+    }
+
+    public static Builder newBuilder() { return Builder.create(); }
+    public Builder newBuilderForType() { return newBuilder(); }
+    public static Builder newBuilder(de.pokerth.protocol.ProtoBuf.LobbySnapshotMessage prototype) {
+      return newBuilder().mergeFrom(prototype);
+    }
+    public Builder toBuilder() { return newBuilder(this); }
+
+    /**
+     * Protobuf type {@code LobbySnapshotMessage}
+     */
+    public static final class Builder extends
+        com.google.protobuf.GeneratedMessageLite.Builder<
+          de.pokerth.protocol.ProtoBuf.LobbySnapshotMessage, Builder>
+        implements de.pokerth.protocol.ProtoBuf.LobbySnapshotMessageOrBuilder {
+      // Construct using de.pokerth.protocol.ProtoBuf.LobbySnapshotMessage.newBuilder()
+      private Builder() {
+        maybeForceBuilderInitialization();
+      }
+
+      private void maybeForceBuilderInitialization() {
+      }
+      private static Builder create() {
+        return new Builder();
+      }
+
+      public Builder clear() {
+        super.clear();
+        playerIds_ = java.util.Collections.emptyList();
+        bitField0_ = (bitField0_ & ~0x00000001);
+        games_ = java.util.Collections.emptyList();
+        bitField0_ = (bitField0_ & ~0x00000002);
+        return this;
+      }
+
+      public Builder clone() {
+        return create().mergeFrom(buildPartial());
+      }
+
+      public de.pokerth.protocol.ProtoBuf.LobbySnapshotMessage getDefaultInstanceForType() {
+        return de.pokerth.protocol.ProtoBuf.LobbySnapshotMessage.getDefaultInstance();
+      }
+
+      public de.pokerth.protocol.ProtoBuf.LobbySnapshotMessage build() {
+        de.pokerth.protocol.ProtoBuf.LobbySnapshotMessage result = buildPartial();
+        if (!result.isInitialized()) {
+          throw newUninitializedMessageException(result);
+        }
+        return result;
+      }
+
+      public de.pokerth.protocol.ProtoBuf.LobbySnapshotMessage buildPartial() {
+        de.pokerth.protocol.ProtoBuf.LobbySnapshotMessage result = new de.pokerth.protocol.ProtoBuf.LobbySnapshotMessage(this);
+        int from_bitField0_ = bitField0_;
+        if (((bitField0_ & 0x00000001) == 0x00000001)) {
+          playerIds_ = java.util.Collections.unmodifiableList(playerIds_);
+          bitField0_ = (bitField0_ & ~0x00000001);
+        }
+        result.playerIds_ = playerIds_;
+        if (((bitField0_ & 0x00000002) == 0x00000002)) {
+          games_ = java.util.Collections.unmodifiableList(games_);
+          bitField0_ = (bitField0_ & ~0x00000002);
+        }
+        result.games_ = games_;
+        return result;
+      }
+
+      public Builder mergeFrom(de.pokerth.protocol.ProtoBuf.LobbySnapshotMessage other) {
+        if (other == de.pokerth.protocol.ProtoBuf.LobbySnapshotMessage.getDefaultInstance()) return this;
+        if (!other.playerIds_.isEmpty()) {
+          if (playerIds_.isEmpty()) {
+            playerIds_ = other.playerIds_;
+            bitField0_ = (bitField0_ & ~0x00000001);
+          } else {
+            ensurePlayerIdsIsMutable();
+            playerIds_.addAll(other.playerIds_);
+          }
+          
+        }
+        if (!other.games_.isEmpty()) {
+          if (games_.isEmpty()) {
+            games_ = other.games_;
+            bitField0_ = (bitField0_ & ~0x00000002);
+          } else {
+            ensureGamesIsMutable();
+            games_.addAll(other.games_);
+          }
+          
+        }
+        return this;
+      }
+
+      public final boolean isInitialized() {
+        for (int i = 0; i < getGamesCount(); i++) {
+          if (!getGames(i).isInitialized()) {
+            
+            return false;
+          }
+        }
+        return true;
+      }
+
+      public Builder mergeFrom(
+          com.google.protobuf.CodedInputStream input,
+          com.google.protobuf.ExtensionRegistryLite extensionRegistry)
+          throws java.io.IOException {
+        de.pokerth.protocol.ProtoBuf.LobbySnapshotMessage parsedMessage = null;
+        try {
+          parsedMessage = PARSER.parsePartialFrom(input, extensionRegistry);
+        } catch (com.google.protobuf.InvalidProtocolBufferException e) {
+          parsedMessage = (de.pokerth.protocol.ProtoBuf.LobbySnapshotMessage) e.getUnfinishedMessage();
+          throw e;
+        } finally {
+          if (parsedMessage != null) {
+            mergeFrom(parsedMessage);
+          }
+        }
+        return this;
+      }
+      private int bitField0_;
+
+      // repeated uint32 playerIds = 1 [packed = true];
+      private java.util.List<java.lang.Integer> playerIds_ = java.util.Collections.emptyList();
+      private void ensurePlayerIdsIsMutable() {
+        if (!((bitField0_ & 0x00000001) == 0x00000001)) {
+          playerIds_ = new java.util.ArrayList<java.lang.Integer>(playerIds_);
+          bitField0_ |= 0x00000001;
+         }
+      }
+      /**
+       * <code>repeated uint32 playerIds = 1 [packed = true];</code>
+       */
+      public java.util.List<java.lang.Integer>
+          getPlayerIdsList() {
+        return java.util.Collections.unmodifiableList(playerIds_);
+      }
+      /**
+       * <code>repeated uint32 playerIds = 1 [packed = true];</code>
+       */
+      public int getPlayerIdsCount() {
+        return playerIds_.size();
+      }
+      /**
+       * <code>repeated uint32 playerIds = 1 [packed = true];</code>
+       */
+      public int getPlayerIds(int index) {
+        return playerIds_.get(index);
+      }
+      /**
+       * <code>repeated uint32 playerIds = 1 [packed = true];</code>
+       */
+      public Builder setPlayerIds(
+          int index, int value) {
+        ensurePlayerIdsIsMutable();
+        playerIds_.set(index, value);
+        
+        return this;
+      }
+      /**
+       * <code>repeated uint32 playerIds = 1 [packed = true];</code>
+       */
+      public Builder addPlayerIds(int value) {
+        ensurePlayerIdsIsMutable();
+        playerIds_.add(value);
+        
+        return this;
+      }
+      /**
+       * <code>repeated uint32 playerIds = 1 [packed = true];</code>
+       */
+      public Builder addAllPlayerIds(
+          java.lang.Iterable<? extends java.lang.Integer> values) {
+        ensurePlayerIdsIsMutable();
+        super.addAll(values, playerIds_);
+        
+        return this;
+      }
+      /**
+       * <code>repeated uint32 playerIds = 1 [packed = true];</code>
+       */
+      public Builder clearPlayerIds() {
+        playerIds_ = java.util.Collections.emptyList();
+        bitField0_ = (bitField0_ & ~0x00000001);
+        
+        return this;
+      }
+
+      // repeated .GameListNewMessage games = 2;
+      private java.util.List<de.pokerth.protocol.ProtoBuf.GameListNewMessage> games_ =
+        java.util.Collections.emptyList();
+      private void ensureGamesIsMutable() {
+        if (!((bitField0_ & 0x00000002) == 0x00000002)) {
+          games_ = new java.util.ArrayList<de.pokerth.protocol.ProtoBuf.GameListNewMessage>(games_);
+          bitField0_ |= 0x00000002;
+         }
+      }
+
+      /**
+       * <code>repeated .GameListNewMessage games = 2;</code>
+       */
+      public java.util.List<de.pokerth.protocol.ProtoBuf.GameListNewMessage> getGamesList() {
+        return java.util.Collections.unmodifiableList(games_);
+      }
+      /**
+       * <code>repeated .GameListNewMessage games = 2;</code>
+       */
+      public int getGamesCount() {
+        return games_.size();
+      }
+      /**
+       * <code>repeated .GameListNewMessage games = 2;</code>
+       */
+      public de.pokerth.protocol.ProtoBuf.GameListNewMessage getGames(int index) {
+        return games_.get(index);
+      }
+      /**
+       * <code>repeated .GameListNewMessage games = 2;</code>
+       */
+      public Builder setGames(
+          int index, de.pokerth.protocol.ProtoBuf.GameListNewMessage value) {
+        if (value == null) {
+          throw new NullPointerException();
+        }
+        ensureGamesIsMutable();
+        games_.set(index, value);
+
+        return this;
+      }
+      /**
+       * <code>repeated .GameListNewMessage games = 2;</code>
+       */
+      public Builder setGames(
+          int index, de.pokerth.protocol.ProtoBuf.GameListNewMessage.Builder builderForValue) {
+        ensureGamesIsMutable();
+        games_.set(index, builderForValue.build());
+
+        return this;
+      }
+      /**
+       * <code>repeated .GameListNewMessage games = 2;</code>
+       */
+      public Builder addGames(de.pokerth.protocol.ProtoBuf.GameListNewMessage value) {
+        if (value == null) {
+          throw new NullPointerException();
+        }
+        ensureGamesIsMutable();
+        games_.add(value);
+
+        return this;
+      }
+      /**
+       * <code>repeated .GameListNewMessage games = 2;</code>
+       */
+      public Builder addGames(
+          int index, de.pokerth.protocol.ProtoBuf.GameListNewMessage value) {
+        if (value == null) {
+          throw new NullPointerException();
+        }
+        ensureGamesIsMutable();
+        games_.add(index, value);
+
+        return this;
+      }
+      /**
+       * <code>repeated .GameListNewMessage games = 2;</code>
+       */
+      public Builder addGames(
+          de.pokerth.protocol.ProtoBuf.GameListNewMessage.Builder builderForValue) {
+        ensureGamesIsMutable();
+        games_.add(builderForValue.build());
+
+        return this;
+      }
+      /**
+       * <code>repeated .GameListNewMessage games = 2;</code>
+       */
+      public Builder addGames(
+          int index, de.pokerth.protocol.ProtoBuf.GameListNewMessage.Builder builderForValue) {
+        ensureGamesIsMutable();
+        games_.add(index, builderForValue.build());
+
+        return this;
+      }
+      /**
+       * <code>repeated .GameListNewMessage games = 2;</code>
+       */
+      public Builder addAllGames(
+          java.lang.Iterable<? extends de.pokerth.protocol.ProtoBuf.GameListNewMessage> values) {
+        ensureGamesIsMutable();
+        super.addAll(values, games_);
+
+        return this;
+      }
+      /**
+       * <code>repeated .GameListNewMessage games = 2;</code>
+       */
+      public Builder clearGames() {
+        games_ = java.util.Collections.emptyList();
+        bitField0_ = (bitField0_ & ~0x00000002);
+
+        return this;
+      }
+      /**
+       * <code>repeated .GameListNewMessage games = 2;</code>
+       */
+      public Builder removeGames(int index) {
+        ensureGamesIsMutable();
+        games_.remove(index);
+
+        return this;
+      }
+
+      // @@protoc_insertion_point(builder_scope:LobbySnapshotMessage)
+    }
+
+    static {
+      defaultInstance = new LobbySnapshotMessage(true);
+      defaultInstance.initFields();
+    }
+
+    // @@protoc_insertion_point(class_scope:LobbySnapshotMessage)
+  }
+
   public interface GameListUpdateMessageOrBuilder
       extends com.google.protobuf.MessageLiteOrBuilder {
 
@@ -49339,16 +50213,540 @@ public final class ProtoBuf {
             }
             case 8: {
               bitField0_ |= 0x00000001;
-              banPlayerId_ = input.readUInt32();
+              banPlayerId_ = input.readUInt32();
+              break;
+            }
+            case 16: {
+              int rawValue = input.readEnum();
+              de.pokerth.protocol.ProtoBuf.AdminBanPlayerAckMessage.AdminBanPlayerResult value = de.pokerth.protocol.ProtoBuf.AdminBanPlayerAckMessage.AdminBanPlayerResult.valueOf(rawValue);
+              if (value != null) {
+                bitField0_ |= 0x00000002;
+                banPlayerResult_ = value;
+              }
+              break;
+            }
+          }
+        }
+      } catch (com.google.protobuf.InvalidProtocolBufferException e) {
+        throw e.setUnfinishedMessage(this);
+      } catch (java.io.IOException e) {
+        throw new com.google.protobuf.InvalidProtocolBufferException(
+            e.getMessage()).setUnfinishedMessage(this);
+      } finally {
+        makeExtensionsImmutable();
+      }
+    }
+    public static com.google.protobuf.Parser<AdminBanPlayerAckMessage> PARSER =
+        new com.google.protobuf.AbstractParser<AdminBanPlayerAckMessage>() {
+      public AdminBanPlayerAckMessage parsePartialFrom(
+          com.google.protobuf.CodedInputStream input,
+          com.google.protobuf.ExtensionRegistryLite extensionRegistry)
+          throws com.google.protobuf.InvalidProtocolBufferException {
+        return new AdminBanPlayerAckMessage(input, extensionRegistry);
+      }
+    };
+
+    @java.lang.Override
+    public com.google.protobuf.Parser<AdminBanPlayerAckMessage> getParserForType() {
+      return PARSER;
+    }
+
+    /**
+     * Protobuf enum {@code AdminBanPlayerAckMessage.AdminBanPlayerResult}
+     */
+    public enum AdminBanPlayerResult
+        implements com.google.protobuf.Internal.EnumLite {
+      /**
+       * <code>banPlayerAccepted = 0;</code>
+       */
+      banPlayerAccepted(0, 0),
+      /**
+       * <code>banPlayerPending = 1;</code>
+       */
+      banPlayerPending(1, 1),
+      /**
+       * <code>banPlayerNoDB = 2;</code>
+       */
+      banPlayerNoDB(2, 2),
+      /**
+       * <code>banPlayerDBError = 3;</code>
+       */
+      banPlayerDBError(3, 3),
+      /**
+       * <code>banPlayerInvalid = 4;</code>
+       */
+      banPlayerInvalid(4, 4),
+      ;
+
+      /**
+       * <code>banPlayerAccepted = 0;</code>
+       */
+      public static final int banPlayerAccepted_VALUE = 0;
+      /**
+       * <code>banPlayerPending = 1;</code>
+       */
+      public static final int banPlayerPending_VALUE = 1;
+      /**
+       * <code>banPlayerNoDB = 2;</code>
+       */
+      public static final int banPlayerNoDB_VALUE = 2;
+      /**
+       * <code>banPlayerDBError = 3;</code>
+       */
+      public static final int banPlayerDBError_VALUE = 3;
+      /**
+       * <code>banPlayerInvalid = 4;</code>
+       */
+      public static final int banPlayerInvalid_VALUE = 4;
+
+
+      public final int getNumber() { return value; }
+
+      public static AdminBanPlayerResult valueOf(int value) {
+        switch (value) {
+          case 0: return banPlayerAccepted;
+          case 1: return banPlayerPending;
+          case 2: return banPlayerNoDB;
+          case 3: return banPlayerDBError;
+          case 4: return banPlayerInvalid;
+          default: return null;
+        }
+      }
+
+      public static com.google.protobuf.Internal.EnumLiteMap<AdminBanPlayerResult>
+          internalGetValueMap() {
+        return internalValueMap;
+      }
+      private static com.google.protobuf.Internal.EnumLiteMap<AdminBanPlayerResult>
+          internalValueMap =
+            new com.google.protobuf.Internal.EnumLiteMap<AdminBanPlayerResult>() {
+              public AdminBanPlayerResult findValueByNumber(int number) {
+                return AdminBanPlayerResult.valueOf(number);
+              }
+            };
+
+      private final int value;
+
+      private AdminBanPlayerResult(int index, int value) {
+        this.value = value;
+      }
+
+      // @@protoc_insertion_point(enum_scope:AdminBanPlayerAckMessage.AdminBanPlayerResult)
+    }
+
+    private int bitField0_;
+    // required uint32 banPlayerId = 1;
+    public static final int BANPLAYERID_FIELD_NUMBER = 1;
+    private int banPlayerId_;
+    /**
+     * <code>required uint32 banPlayerId = 1;</code>
+     */
+    public boolean hasBanPlayerId() {
+      return ((bitField0_ & 0x00000001) == 0x00000001);
+    }
+    /**
+     * <code>required uint32 banPlayerId = 1;</code>
+     */
+    public int getBanPlayerId() {
+      return banPlayerId_;
+    }
+
+    // required .AdminBanPlayerAckMessage.AdminBanPlayerResult banPlayerResult = 2;
+    public static final int BANPLAYERRESULT_FIELD_NUMBER = 2;
+    private de.pokerth.protocol.ProtoBuf.AdminBanPlayerAckMessage.AdminBanPlayerResult banPlayerResult_;
+    /**
+     * <code>required .AdminBanPlayerAckMessage.AdminBanPlayerResult banPlayerResult = 2;</code>
+     */
+    public boolean hasBanPlayerResult() {
+      return ((bitField0_ & 0x00000002) == 0x00000002);
+    }
+    /**
+     * <code>required .AdminBanPlayerAckMessage.AdminBanPlayerResult banPlayerResult = 2;</code>
+     */
+    public de.pokerth.protocol.ProtoBuf.AdminBanPlayerAckMessage.AdminBanPlayerResult getBanPlayerResult() {
+      return banPlayerResult_;
+    }
+
+    private void initFields() {
+      banPlayerId_ = 0;
+      banPlayerResult_ = de.pokerth.protocol.ProtoBuf.AdminBanPlayerAckMessage.AdminBanPlayerResult.banPlayerAccepted;
+    }
+    private byte memoizedIsInitialized = -1;
+    public final boolean isInitialized() {
+      byte isInitialized = memoizedIsInitialized;
+      if (isInitialized != -1) return isInitialized == 1;
+
+      if (!hasBanPlayerId()) {
+        memoizedIsInitialized = 0;
+        return false;
+      }
+      if (!hasBanPlayerResult()) {
+        memoizedIsInitialized = 0;
+        return false;
+      }
+      memoizedIsInitialized = 1;
+      return true;
+    }
+
+    public void writeTo(com.google.protobuf.CodedOutputStream output)
+                        throws java.io.IOException {
+      getSerializedSize();
+      if (((bitField0_ & 0x00000001) == 0x00000001)) {
+        output.writeUInt32(1, banPlayerId_);
+      }
+      if (((bitField0_ & 0x00000002) == 0x00000002)) {
+        output.writeEnum(2, banPlayerResult_.getNumber());
+      }
+    }
+
+    private int memoizedSerializedSize = -1;
+    public int getSerializedSize() {
+      int size = memoizedSerializedSize;
+      if (size != -1) return size;
+
+      size = 0;
+      if (((bitField0_ & 0x00000001) == 0x00000001)) {
+        size += com.google.protobuf.CodedOutputStream
+          .computeUInt32Size(1, banPlayerId_);
+      }
+      if (((bitField0_ & 0x00000002) == 0x00000002)) {
+        size += com.google.protobuf.CodedOutputStream
+          .computeEnumSize(2, banPlayerResult_.getNumber());
+      }
+      memoizedSerializedSize = size;
+      return size;
+    }
+
+    private static final long serialVersionUID = 0L;
+    @java.lang.Override
+    protected java.lang.Object writeReplace()
+        throws java.io.ObjectStreamException {
+      return super.writeReplace();
+    }
+
+    public static de.pokerth.protocol.ProtoBuf.AdminBanPlayerAckMessage parseFrom(
+        com.google.protobuf.ByteString data)
+        throws com.google.protobuf.InvalidProtocolBufferException {
+      return PARSER.parseFrom(data);
+    }
+    public static de.pokerth.protocol.ProtoBuf.AdminBanPlayerAckMessage parseFrom(
+        com.google.protobuf.ByteString data,
+        com.google.protobuf.ExtensionRegistryLite extensionRegistry)
+        throws com.google.protobuf.InvalidProtocolBufferException {
+      return PARSER.parseFrom(data, extensionRegistry);
+    }
+    public static de.pokerth.protocol.ProtoBuf.AdminBanPlayerAckMessage parseFrom(byte[] data)
+        throws com.google.protobuf.InvalidProtocolBufferException {
+      return PARSER.parseFrom(data);
+    }
+    public static de.pokerth.protocol.ProtoBuf.AdminBanPlayerAckMessage parseFrom(
+        byte[] data,
+        com.google.protobuf.ExtensionRegistryLite extensionRegistry)
+        throws com.google.protobuf.InvalidProtocolBufferException {
+      return PARSER.parseFrom(data, extensionRegistry);
+    }
+    public static de.pokerth.protocol.ProtoBuf.AdminBanPlayerAckMessage parseFrom(java.io.InputStream input)
+        throws java.io.IOException {
+      return PARSER.parseFrom(input);
+    }
+    public static de.pokerth.protocol.ProtoBuf.AdminBanPlayerAckMessage parseFrom(
+        java.io.InputStream input,
+        com.google.protobuf.ExtensionRegistryLite extensionRegistry)
+        throws java.io.IOException {
+      return PARSER.parseFrom(input, extensionRegistry);
+    }
+    public static de.pokerth.protocol.ProtoBuf.AdminBanPlayerAckMessage parseDelimitedFrom(java.io.InputStream input)
+        throws java.io.IOException {
+      return PARSER.parseDelimitedFrom(input);
+    }
+    public static de.pokerth.protocol.ProtoBuf.AdminBanPlayerAckMessage parseDelimitedFrom(
+        java.io.InputStream input,
+        com.google.protobuf.ExtensionRegistryLite extensionRegistry)
+        throws java.io.IOException {
+      return PARSER.parseDelimitedFrom(input, extensionRegistry);
+    }
+    public static de.pokerth.protocol.ProtoBuf.AdminBanPlayerAckMessage parseFrom(
+        com.google.protobuf.CodedInputStream input)
+        throws java.io.IOException {
+      return PARSER.parseFrom(input);
+    }
+    public static de.pokerth.protocol.ProtoBuf.AdminBanPlayerAckMessage parseFrom(
+        com.google.protobuf.CodedInputStream input,
+        com.google.protobuf.ExtensionRegistryLite extensionRegistry)
+        throws java.io.IOException {
+      return PARSER.parseFrom(input, extensionRegistry);
+    }
+
+    public static Builder newBuilder() { return Builder.create(); }
+    public Builder newBuilderForType() { return newBuilder(); }
+    public static Builder newBuilder(de.pokerth.protocol.ProtoBuf.AdminBanPlayerAckMessage prototype) {
+      return newBuilder().mergeFrom(prototype);
+    }
+    public Builder toBuilder() { return newBuilder(this); }
+
+    /**
+     * Protobuf type {@code AdminBanPlayerAckMessage}
+     */
+    public static final class Builder extends
+        com.google.protobuf.GeneratedMessageLite.Builder<
+          de.pokerth.protocol.ProtoBuf.AdminBanPlayerAckMessage, Builder>
+        implements de.pokerth.protocol.ProtoBuf.AdminBanPlayerAckMessageOrBuilder {
+      // Construct using de.pokerth.protocol.ProtoBuf.AdminBanPlayerAckMessage.newBuilder()
+      private Builder() {
+        maybeForceBuilderInitialization();
+      }
+
+      private void maybeForceBuilderInitialization() {
+      }
+      private static Builder create() {
+        return new Builder();
+      }
+
+      public Builder clear() {
+        super.clear();
+        banPlayerId_ = 0;
+        bitField0_ = (bitField0_ & ~0x00000001);
+        banPlayerResult_ = de.pokerth.protocol.ProtoBuf.AdminBanPlayerAckMessage.AdminBanPlayerResult.banPlayerAccepted;
+        bitField0_ = (bitField0_ & ~0x00000002);
+        return this;
+      }
+
+      public Builder clone() {
+        return create().mergeFrom(buildPartial());
+      }
+
+      public de.pokerth.protocol.ProtoBuf.AdminBanPlayerAckMessage getDefaultInstanceForType() {
+        return de.pokerth.protocol.ProtoBuf.AdminBanPlayerAckMessage.getDefaultInstance();
+      }
+
+      public de.pokerth.protocol.ProtoBuf.AdminBanPlayerAckMessage build() {
+        de.pokerth.protocol.ProtoBuf.AdminBanPlayerAckMessage result = buildPartial();
+        if (!result.isInitialized()) {
+          throw newUninitializedMessageException(result);
+        }
+        return result;
+      }
+
+      public de.pokerth.protocol.ProtoBuf.AdminBanPlayerAckMessage buildPartial() {
+        de.pokerth.protocol.ProtoBuf.AdminBanPlayerAckMessage result = new de.pokerth.protocol.ProtoBuf.AdminBanPlayerAckMessage(this);
+        int from_bitField0_ = bitField0_;
+        int to_bitField0_ = 0;
+        if (((from_bitField0_ & 0x00000001) == 0x00000001)) {
+          to_bitField0_ |= 0x00000001;
+        }
+        result.banPlayerId_ = banPlayerId_;
+        if (((from_bitField0_ & 0x00000002) == 0x00000002)) {
+          to_bitField0_ |= 0x00000002;
+        }
+        result.banPlayerResult_ = banPlayerResult_;
+        result.bitField0_ = to_bitField0_;
+        return result;
+      }
+
+      public Builder mergeFrom(de.pokerth.protocol.ProtoBuf.AdminBanPlayerAckMessage other) {
+        if (other == de.pokerth.protocol.ProtoBuf.AdminBanPlayerAckMessage.getDefaultInstance()) return this;
+        if (other.hasBanPlayerId()) {
+          setBanPlayerId(other.getBanPlayerId());
+        }
+        if (other.hasBanPlayerResult()) {
+          setBanPlayerResult(other.getBanPlayerResult());
+        }
+        return this;
+      }
+
+      public final boolean isInitialized() {
+        if (!hasBanPlayerId()) {
+          
+          return false;
+        }
+        if (!hasBanPlayerResult()) {
+          
+          return false;
+        }
+        return true;
+      }
+
+      public Builder mergeFrom(
+          com.google.protobuf.CodedInputStream input,
+          com.google.protobuf.ExtensionRegistryLite extensionRegistry)
+          throws java.io.IOException {
+        de.pokerth.protocol.ProtoBuf.AdminBanPlayerAckMessage parsedMessage = null;
+        try {
+          parsedMessage = PARSER.parsePartialFrom(input, extensionRegistry);
+        } catch (com.google.protobuf.InvalidProtocolBufferException e) {
+          parsedMessage = (de.pokerth.protocol.ProtoBuf.AdminBanPlayerAckMessage) e.getUnfinishedMessage();
+          throw e;
+        } finally {
+          if (parsedMessage != null) {
+            mergeFrom(parsedMessage);
+          }
+        }
+        return this;
+      }
+      private int bitField0_;
+
+      // required uint32 banPlayerId = 1;
+      private int banPlayerId_ ;
+      /**
+       * <code>required uint32 banPlayerId = 1;</code>
+       */
+      public boolean hasBanPlayerId() {
+        return ((bitField0_ & 0x00000001) == 0x00000001);
+      }
+      /**
+       * <code>required uint32 banPlayerId = 1;</code>
+       */
+      public int getBanPlayerId() {
+        return banPlayerId_;
+      }
+      /**
+       * <code>required uint32 banPlayerId = 1;</code>
+       */
+      public Builder setBanPlayerId(int value) {
+        bitField0_ |= 0x00000001;
+        banPlayerId_ = value;
+        
+        return this;
+      }
+      /**
+       * <code>required uint32 banPlayerId = 1;</code>
+       */
+      public Builder clearBanPlayerId() {
+        bitField0_ = (bitField0_ & ~0x00000001);
+        banPlayerId_ = 0;
+        
+        return this;
+      }
+
+      // required .AdminBanPlayerAckMessage.AdminBanPlayerResult banPlayerResult = 2;
+      private de.pokerth.protocol.ProtoBuf.AdminBanPlayerAckMessage.AdminBanPlayerResult banPlayerResult_ = de.pokerth.protocol.ProtoBuf.AdminBanPlayerAckMessage.AdminBanPlayerResult.banPlayerAccepted;
+      /**
+       * <code>required .AdminBanPlayerAckMessage.AdminBanPlayerResult banPlayerResult = 2;</code>
+       */
+      public boolean hasBanPlayerResult() {
+        return ((bitField0_ & 0x00000002) == 0x00000002);
+      }
+      /**
+       * <code>required .AdminBanPlayerAckMessage.AdminBanPlayerResult banPlayerResult = 2;</code>
+       */
+      public de.pokerth.protocol.ProtoBuf.AdminBanPlayerAckMessage.AdminBanPlayerResult getBanPlayerResult() {
+        return banPlayerResult_;
+      }
+      /**
+       * <code>required .AdminBanPlayerAckMessage.AdminBanPlayerResult banPlayerResult = 2;</code>
+       */
+      public Builder setBanPlayerResult(de.pokerth.protocol.ProtoBuf.AdminBanPlayerAckMessage.AdminBanPlayerResult value) {
+        if (value == null) {
+          throw new NullPointerException();
+        }
+        bitField0_ |= 0x00000002;
+        banPlayerResult_ = value;
+        
+        return this;
+      }
+      /**
+       * <code>required .AdminBanPlayerAckMessage.AdminBanPlayerResult banPlayerResult = 2;</code>
+       */
+      public Builder clearBanPlayerResult() {
+        bitField0_ = (bitField0_ & ~0x00000002);
+        banPlayerResult_ = de.pokerth.protocol.ProtoBuf.AdminBanPlayerAckMessage.AdminBanPlayerResult.banPlayerAccepted;
+        
+        return this;
+      }
+
+      // @@protoc_insertion_point(builder_scope:AdminBanPlayerAckMessage)
+    }
+
+    static {
+      defaultInstance = new AdminBanPlayerAckMessage(true);
+      defaultInstance.initFields();
+    }
+
+    // @@protoc_insertion_point(class_scope:AdminBanPlayerAckMessage)
+  }
+
+  public interface CompressedPacketsMessageOrBuilder
+      extends com.google.protobuf.MessageLiteOrBuilder {
+
+    // required uint32 uncompressedSize = 1;
+    /**
+     * <code>required uint32 uncompressedSize = 1;</code>
+     */
+    boolean hasUncompressedSize();
+    /**
+     * <code>required uint32 uncompressedSize = 1;</code>
+     */
+    int getUncompressedSize();
+
+    // required bytes compressedData = 2;
+    /**
+     * <code>required bytes compressedData = 2;</code>
+     *
+     * <pre>
+     * zlib compressed packets, each with the usual size header.
+     * </pre>
+     */
+    boolean hasCompressedData();
+    /**
+     * <code>required bytes compressedData = 2;</code>
+     *
+     * <pre>
+     * zlib compressed packets, each with the usual size header.
+     * </pre>
+     */
+    com.google.protobuf.ByteString getCompressedData();
+  }
+  /**
+   * Protobuf type {@code CompressedPacketsMessage}
+   */
+  public static final class CompressedPacketsMessage extends
+      com.google.protobuf.GeneratedMessageLite
+      implements CompressedPacketsMessageOrBuilder {
+    // Use CompressedPacketsMessage.newBuilder() to construct.
+    private CompressedPacketsMessage(com.google.protobuf.GeneratedMessageLite.Builder builder) {
+      super(builder);
+
+    }
+    private CompressedPacketsMessage(boolean noInit) {}
+
+    private static final CompressedPacketsMessage defaultInstance;
+    public static CompressedPacketsMessage getDefaultInstance() {
+      return defaultInstance;
+    }
+
+    public CompressedPacketsMessage getDefaultInstanceForType() {
+      return defaultInstance;
+    }
+
+    private CompressedPacketsMessage(
+        com.google.protobuf.CodedInputStream input,
+        com.google.protobuf.ExtensionRegistryLite extensionRegistry)
+        throws com.google.protobuf.InvalidProtocolBufferException {
+      initFields();
+      int mutable_bitField0_ = 0;
+      try {
+        boolean done = false;
+        while (!done) {
+          int tag = input.readTag();
+          switch (tag) {
+            case 0:
+              done = true;
+              break;
+            default: {
+              if (!parseUnknownField(input,
+                                     extensionRegistry, tag)) {
+                done = true;
+              }
+              break;
+            }
+            case 8: {
+              bitField0_ |= 0x00000001;
+              uncompressedSize_ = input.readUInt32();
               break;
             }
-            case 16: {
-              int rawValue = input.readEnum();
-              de.pokerth.protocol.ProtoBuf.AdminBanPlayerAckMessage.AdminBanPlayerResult value = de.pokerth.protocol.ProtoBuf.AdminBanPlayerAckMessage.AdminBanPlayerResult.valueOf(rawValue);
-              if (value != null) {
-                bitField0_ |= 0x00000002;
-                banPlayerResult_ = value;
-              }
+            case 18: {
+              bitField0_ |= 0x00000002;
+              compressedData_ = input.readBytes();
               break;
             }
           }
@@ -49362,151 +50760,76 @@ public final class ProtoBuf {
         makeExtensionsImmutable();
       }
     }
-    public static com.google.protobuf.Parser<AdminBanPlayerAckMessage> PARSER =
-        new com.google.protobuf.AbstractParser<AdminBanPlayerAckMessage>() {
-      public AdminBanPlayerAckMessage parsePartialFrom(
+    public static com.google.protobuf.Parser<CompressedPacketsMessage> PARSER =
+        new com.google.protobuf.AbstractParser<CompressedPacketsMessage>() {
+      public CompressedPacketsMessage parsePartialFrom(
           com.google.protobuf.CodedInputStream input,
           com.google.protobuf.ExtensionRegistryLite extensionRegistry)
           throws com.google.protobuf.InvalidProtocolBufferException {
-        return new AdminBanPlayerAckMessage(input, extensionRegistry);
+        return new CompressedPacketsMessage(input, extensionRegistry);
       }
     };
 
     @java.lang.Override
-    public com.google.protobuf.Parser<AdminBanPlayerAckMessage> getParserForType() {
+    public com.google.protobuf.Parser<CompressedPacketsMessage> getParserForType() {
       return PARSER;
     }
 
-    /**
-     * Protobuf enum {@code AdminBanPlayerAckMessage.AdminBanPlayerResult}
-     */
-    public enum AdminBanPlayerResult
-        implements com.google.protobuf.Internal.EnumLite {
-      /**
-       * <code>banPlayerAccepted = 0;</code>
-       */
-      banPlayerAccepted(0, 0),
-      /**
-       * <code>banPlayerPending = 1;</code>
-       */
-      banPlayerPending(1, 1),
-      /**
-       * <code>banPlayerNoDB = 2;</code>
-       */
-      banPlayerNoDB(2, 2),
-      /**
-       * <code>banPlayerDBError = 3;</code>
-       */
-      banPlayerDBError(3, 3),
-      /**
-       * <code>banPlayerInvalid = 4;</code>
-       */
-      banPlayerInvalid(4, 4),
-      ;
-
-      /**
-       * <code>banPlayerAccepted = 0;</code>
-       */
-      public static final int banPlayerAccepted_VALUE = 0;
-      /**
-       * <code>banPlayerPending = 1;</code>
-       */
-      public static final int banPlayerPending_VALUE = 1;
-      /**
-       * <code>banPlayerNoDB = 2;</code>
-       */
-      public static final int banPlayerNoDB_VALUE = 2;
-      /**
-       * <code>banPlayerDBError = 3;</code>
-       */
-      public static final int banPlayerDBError_VALUE = 3;
-      /**
-       * <code>banPlayerInvalid = 4;</code>
-       */
-      public static final int banPlayerInvalid_VALUE = 4;
-
-
-      public final int getNumber() { return value; }
-
-      public static AdminBanPlayerResult valueOf(int value) {
-        switch (value) {
-          case 0: return banPlayerAccepted;
-          case 1: return banPlayerPending;
-          case 2: return banPlayerNoDB;
-          case 3: return banPlayerDBError;
-          case 4: return banPlayerInvalid;
-          default: return null;
-        }
-      }
-
-      public static com.google.protobuf.Internal.EnumLiteMap<AdminBanPlayerResult>
-          internalGetValueMap() {
-        return internalValueMap;
-      }
-      private static com.google.protobuf.Internal.EnumLiteMap<AdminBanPlayerResult>
-          internalValueMap =
-            new com.google.protobuf.Internal.EnumLiteMap<AdminBanPlayerResult>() {
-              public AdminBanPlayerResult findValueByNumber(int number) {
-                return AdminBanPlayerResult.valueOf(number);
-              }
-            };
-
-      private final int value;
-
-      private AdminBanPlayerResult(int index, int value) {
-        this.value = value;
-      }
-
-      // @@protoc_insertion_point(enum_scope:AdminBanPlayerAckMessage.AdminBanPlayerResult)
-    }
-
     private int bitField0_;
-    // required uint32 banPlayerId = 1;
-    public static final int BANPLAYERID_FIELD_NUMBER = 1;
-    private int banPlayerId_;
+    // required uint32 uncompressedSize = 1;
+    public static final int UNCOMPRESSEDSIZE_FIELD_NUMBER = 1;
+    private int uncompressedSize_;
     /**
-     * <code>required uint32 banPlayerId = 1;</code>
+     * <code>required uint32 uncompressedSize = 1;</code>
      */
-    public boolean hasBanPlayerId() {
+    public boolean hasUncompressedSize() {
       return ((bitField0_ & 0x00000001) == 0x00000001);
     }
     /**
-     * <code>required uint32 banPlayerId = 1;</code>
+     * <code>required uint32 uncompressedSize = 1;</code>
      */
-    public int getBanPlayerId() {
-      return banPlayerId_;
+    public int getUncompressedSize() {
+      return uncompressedSize_;
     }
 
-    // required .AdminBanPlayerAckMessage.AdminBanPlayerResult banPlayerResult = 2;
-    public static final int BANPLAYERRESULT_FIELD_NUMBER = 2;
-    private de.pokerth.protocol.ProtoBuf.AdminBanPlayerAckMessage.AdminBanPlayerResult banPlayerResult_;
+    // required bytes compressedData = 2;
+    public static final int COMPRESSEDDATA_FIELD_NUMBER = 2;
+    private com.google.protobuf.ByteString compressedData_;
     /**
-     * <code>required .AdminBanPlayerAckMessage.AdminBanPlayerResult banPlayerResult = 2;</code>
+     * <code>required bytes compressedData = 2;</code>
+     *
+     * <pre>
+     * zlib compressed packets, each with the usual size header.
+     * </pre>
      */
-    public boolean hasBanPlayerResult() {
+    public boolean hasCompressedData() {
       return ((bitField0_ & 0x00000002) == 0x00000002);
     }
     /**
-     * <code>required .AdminBanPlayerAckMessage.AdminBanPlayerResult banPlayerResult = 2;</code>
+     * <code>required bytes compressedData = 2;</code>
+     *
+     * <pre>
+     * zlib compressed packets, each with the usual size header.
+     * </pre>
      */
-    public de.pokerth.protocol.ProtoBuf.AdminBanPlayerAckMessage.AdminBanPlayerResult getBanPlayerResult() {
-      return banPlayerResult_;
+    public com.google.protobuf.ByteString getCompressedData() {
+      return compressedData_;
     }
 
     private void initFields() {
-      banPlayerId_ = 0;
-      banPlayerResult_ = de.pokerth.protocol.ProtoBuf.AdminBanPlayerAckMessage.AdminBanPlayerResult.banPlayerAccepted;
+      uncompressedSize_ = 0;
+      compressedData_ = com.google.protobuf.ByteString.EMPTY;
     }
     private byte memoizedIsInitialized = -1;
     public final boolean isInitialized() {
       byte isInitialized = memoizedIsInitialized;
       if (isInitialized != -1) return isInitialized == 1;
 
-      if (!hasBanPlayerId()) {
+      if (!hasUncompressedSize()) {
         memoizedIsInitialized = 0;
         return false;
       }
-      if (!hasBanPlayerResult()) {
+      if (!hasCompressedData()) {
         memoizedIsInitialized = 0;
         return false;
       }
@@ -49518,10 +50841,10 @@ public final class ProtoBuf {
                         throws java.io.IOException {
       getSerializedSize();
       if (((bitField0_ & 0x00000001) == 0x00000001)) {
-        output.writeUInt32(1, banPlayerId_);
+        output.writeUInt32(1, uncompressedSize_);
       }
       if (((bitField0_ & 0x00000002) == 0x00000002)) {
-        output.writeEnum(2, banPlayerResult_.getNumber());
+        output.writeBytes(2, compressedData_);
       }
     }
 
@@ -49533,11 +50856,11 @@ public final class ProtoBuf {
       size = 0;
       if (((bitField0_ & 0x00000001) == 0x00000001)) {
         size += com.google.protobuf.CodedOutputStream
-          .computeUInt32Size(1, banPlayerId_);
+          .computeUInt32Size(1, uncompressedSize_);
       }
       if (((bitField0_ & 0x00000002) == 0x00000002)) {
         size += com.google.protobuf.CodedOutputStream
-          .computeEnumSize(2, banPlayerResult_.getNumber());
+          .computeBytesSize(2, compressedData_);
       }
       memoizedSerializedSize = size;
       return size;
@@ -49550,53 +50873,53 @@ public final class ProtoBuf {
       return super.writeReplace();
     }
 
-    public static de.pokerth.protocol.ProtoBuf.AdminBanPlayerAckMessage parseFrom(
+    public static de.pokerth.protocol.ProtoBuf.CompressedPacketsMessage parseFrom(
         com.google.protobuf.ByteString data)
         throws com.google.protobuf.InvalidProtocolBufferException {
       return PARSER.parseFrom(data);
     }
-    public static de.pokerth.protocol.ProtoBuf.AdminBanPlayerAckMessage parseFrom(
+    public static de.pokerth.protocol.ProtoBuf.CompressedPacketsMessage parseFrom(
         com.google.protobuf.ByteString data,
         com.google.protobuf.ExtensionRegistryLite extensionRegistry)
         throws com.google.protobuf.InvalidProtocolBufferException {
       return PARSER.parseFrom(data, extensionRegistry);
     }
-    public static de.pokerth.protocol.ProtoBuf.AdminBanPlayerAckMessage parseFrom(byte[] data)
+    public static de.pokerth.protocol.ProtoBuf.CompressedPacketsMessage parseFrom(byte[] data)
         throws com.google.protobuf.InvalidProtocolBufferException {
       return PARSER.parseFrom(data);
     }
-    public static de.pokerth.protocol.ProtoBuf.AdminBanPlayerAckMessage parseFrom(
+    public static de.pokerth.protocol.ProtoBuf.CompressedPacketsMessage parseFrom(
         byte[] data,
         com.google.protobuf.ExtensionRegistryLite extensionRegistry)
         throws com.google.protobuf.InvalidProtocolBufferException {
       return PARSER.parseFrom(data, extensionRegistry);
     }
-    public static de.pokerth.protocol.ProtoBuf.AdminBanPlayerAckMessage parseFrom(java.io.InputStream input)
+    public static de.pokerth.protocol.ProtoBuf.CompressedPacketsMessage parseFrom(java.io.InputStream input)
         throws java.io.IOException {
       return PARSER.parseFrom(input);
     }
-    public static de.pokerth.protocol.ProtoBuf.AdminBanPlayerAckMessage parseFrom(
+    public static de.pokerth.protocol.ProtoBuf.CompressedPacketsMessage parseFrom(
         java.io.InputStream input,
         com.google.protobuf.ExtensionRegistryLite extensionRegistry)
         throws java.io.IOException {
       return PARSER.parseFrom(input, extensionRegistry);
     }
-    public static de.pokerth.protocol.ProtoBuf.AdminBanPlayerAckMessage parseDelimitedFrom(java.io.InputStream input)
+    public static de.pokerth.protocol.ProtoBuf.CompressedPacketsMessage parseDelimitedFrom(java.io.InputStream input)
         throws java.io.IOException {
       return PARSER.parseDelimitedFrom(input);
     }
-    public static de.pokerth.protocol.ProtoBuf.AdminBanPlayerAckMessage parseDelimitedFrom(
+    public static de.pokerth.protocol.ProtoBuf.CompressedPacketsMessage parseDelimitedFrom(
         java.io.InputStream input,
         com.google.protobuf.ExtensionRegistryLite extensionRegistry)
         throws java.io.IOException {
       return PARSER.parseDelimitedFrom(input, extensionRegistry);
     }
-    public static de.pokerth.protocol.ProtoBuf.AdminBanPlayerAckMessage parseFrom(
+    public static de.pokerth.protocol.ProtoBuf.CompressedPacketsMessage parseFrom(
         com.google.protobuf.CodedInputStream input)
         throws java.io.IOException {
       return PARSER.parseFrom(input);
     }
-    public static de.pokerth.protocol.ProtoBuf.AdminBanPlayerAckMessage parseFrom(
+    public static de.pokerth.protocol.ProtoBuf.CompressedPacketsMessage parseFrom(
         com.google.protobuf.CodedInputStream input,
         com.google.protobuf.ExtensionRegistryLite extensionRegistry)
         throws java.io.IOException {
@@ -49605,19 +50928,19 @@ public final class ProtoBuf {
 
     public static Builder newBuilder() { return Builder.create(); }
     public Builder newBuilderForType() { return newBuilder(); }
-    public static Builder newBuilder(de.pokerth.protocol.ProtoBuf.AdminBanPlayerAckMessage prototype) {
+    public static Builder newBuilder(de.pokerth.protocol.ProtoBuf.CompressedPacketsMessage prototype) {
       return newBuilder().mergeFrom(prototype);
     }
     public Builder toBuilder() { return newBuilder(this); }
 
     /**
-     * Protobuf type {@code AdminBanPlayerAckMessage}
+     * Protobuf type {@code CompressedPacketsMessage}
      */
     public static final class Builder extends
         com.google.protobuf.GeneratedMessageLite.Builder<
-          de.pokerth.protocol.ProtoBuf.AdminBanPlayerAckMessage, Builder>
-        implements de.pokerth.protocol.ProtoBuf.AdminBanPlayerAckMessageOrBuilder {
-      // Construct using de.pokerth.protocol.ProtoBuf.AdminBanPlayerAckMessage.newBuilder()
+          de.pokerth.protocol.ProtoBuf.CompressedPacketsMessage, Builder>
+        implements de.pokerth.protocol.ProtoBuf.CompressedPacketsMessageOrBuilder {
+      // Construct using de.pokerth.protocol.ProtoBuf.CompressedPacketsMessage.newBuilder()
       private Builder() {
         maybeForceBuilderInitialization();
       }
@@ -49630,9 +50953,9 @@ public final class ProtoBuf {
 
       public Builder clear() {
         super.clear();
-        banPlayerId_ = 0;
+        uncompressedSize_ = 0;
         bitField0_ = (bitField0_ & ~0x00000001);
-        banPlayerResult_ = de.pokerth.protocol.ProtoBuf.AdminBanPlayerAckMessage.AdminBanPlayerResult.banPlayerAccepted;
+        compressedData_ = com.google.protobuf.ByteString.EMPTY;
         bitField0_ = (bitField0_ & ~0x00000002);
         return this;
       }
@@ -49641,51 +50964,51 @@ public final class ProtoBuf {
         return create().mergeFrom(buildPartial());
       }
 
-      public de.pokerth.protocol.ProtoBuf.AdminBanPlayerAckMessage getDefaultInstanceForType() {
-        return de.pokerth.protocol.ProtoBuf.AdminBanPlayerAckMessage.getDefaultInstance();
+      public de.pokerth.protocol.ProtoBuf.CompressedPacketsMessage getDefaultInstanceForType() {
+        return de.pokerth.protocol.ProtoBuf.CompressedPacketsMessage.getDefaultInstance();
       }
 
-      public de.pokerth.protocol.ProtoBuf.AdminBanPlayerAckMessage build() {
-        de.pokerth.protocol.ProtoBuf.AdminBanPlayerAckMessage result = buildPartial();
+      public de.pokerth.protocol.ProtoBuf.CompressedPacketsMessage build() {
+        de.pokerth.protocol.ProtoBuf.CompressedPacketsMessage result = buildPartial();
         if (!result.isInitialized()) {
           throw newUninitializedMessageException(result);
         }
         return result;
       }
 
-      public de.pokerth.protocol.ProtoBuf.AdminBanPlayerAckMessage buildPartial() {
-        de.pokerth.protocol.ProtoBuf.AdminBanPlayerAckMessage result = new de.pokerth.protocol.ProtoBuf.AdminBanPlayerAckMessage(this);
+      public de.pokerth.protocol.ProtoBuf.CompressedPacketsMessage buildPartial() {
+        de.pokerth.protocol.ProtoBuf.CompressedPacketsMessage result = new de.pokerth.protocol.ProtoBuf.CompressedPacketsMessage(this);
         int from_bitField0_ = bitField0_;
         int to_bitField0_ = 0;
         if (((from_bitField0_ & 0x00000001) == 0x00000001)) {
           to_bitField0_ |= 0x00000001;
         }
-        result.banPlayerId_ = banPlayerId_;
+        result.uncompressedSize_ = uncompressedSize_;
         if (((from_bitField0_ & 0x00000002) == 0x00000002)) {
           to_bitField0_ |= 0x00000002;
         }
-        result.banPlayerResult_ = banPlayerResult_;
+        result.compressedData_ = compressedData_;
         result.bitField0_ = to_bitField0_;
         return result;
       }
 
-      public Builder mergeFrom(de.pokerth.protocol.ProtoBuf.AdminBanPlayerAckMessage other) {
-        if (other == de.pokerth.protocol.ProtoBuf.AdminBanPlayerAckMessage.getDefaultInstance()) return this;
-        if (other.hasBanPlayerId()) {
-          setBanPlayerId(other.getBanPlayerId());
+      public Builder mergeFrom(de.pokerth.protocol.ProtoBuf.CompressedPacketsMessage other) {
+        if (other == de.pokerth.protocol.ProtoBuf.CompressedPacketsMessage.getDefaultInstance()) return this;
+        if (other.hasUncompressedSize()) {
+          setUncompressedSize(other.getUncompressedSize());
         }
-        if (other.hasBanPlayerResult()) {
-          setBanPlayerResult(other.getBanPlayerResult());
+        if (other.hasCompressedData()) {
+          setCompressedData(other.getCompressedData());
         }
         return this;
       }
 
       public final boolean isInitialized() {
-        if (!hasBanPlayerId()) {
+        if (!hasUncompressedSize()) {
           
           return false;
         }
-        if (!hasBanPlayerResult()) {
+        if (!hasCompressedData()) {
           
           return false;
         }
@@ -49696,11 +51019,11 @@ public final class ProtoBuf {
           com.google.protobuf.CodedInputStream input,
           com.google.protobuf.ExtensionRegistryLite extensionRegistry)
           throws java.io.IOException {
-        de.pokerth.protocol.ProtoBuf.AdminBanPlayerAckMessage parsedMessage = null;
+        de.pokerth.protocol.ProtoBuf.CompressedPacketsMessage parsedMessage = null;
         try {
           parsedMessage = PARSER.parsePartialFrom(input, extensionRegistry);
         } catch (com.google.protobuf.InvalidProtocolBufferException e) {
-          parsedMessage = (de.pokerth.protocol.ProtoBuf.AdminBanPlayerAckMessage) e.getUnfinishedMessage();
+          parsedMessage = (de.pokerth.protocol.ProtoBuf.CompressedPacketsMessage) e.getUnfinishedMessage();
           throw e;
         } finally {
           if (parsedMessage != null) {
@@ -49711,84 +51034,100 @@ public final class ProtoBuf {
       }
       private int bitField0_;
 
-      // required uint32 banPlayerId = 1;
-      private int banPlayerId_ ;
+      // required uint32 uncompressedSize = 1;
+      private int uncompressedSize_ ;
       /**
-       * <code>required uint32 banPlayerId = 1;</code>
+       * <code>required uint32 uncompressedSize = 1;</code>
        */
-      public boolean hasBanPlayerId() {
+      public boolean hasUncompressedSize() {
         return ((bitField0_ & 0x00000001) == 0x00000001);
       }
       /**
-       * <code>required uint32 banPlayerId = 1;</code>
+       * <code>required uint32 uncompressedSize = 1;</code>
        */
-      public int getBanPlayerId() {
-        return banPlayerId_;
+      public int getUncompressedSize() {
+        return uncompressedSize_;
       }
       /**
-       * <code>required uint32 banPlayerId = 1;</code>
+       * <code>required uint32 uncompressedSize = 1;</code>
        */
-      public Builder setBanPlayerId(int value) {
+      public Builder setUncompressedSize(int value) {
         bitField0_ |= 0x00000001;
-        banPlayerId_ = value;
+        uncompressedSize_ = value;
         
         return this;
       }
       /**
-       * <code>required uint32 banPlayerId = 1;</code>
+       * <code>required uint32 uncompressedSize = 1;</code>
        */
-      public Builder clearBanPlayerId() {
+      public Builder clearUncompressedSize() {
         bitField0_ = (bitField0_ & ~0x00000001);
-        banPlayerId_ = 0;
+        uncompressedSize_ = 0;
         
         return this;
       }
 
-      // required .AdminBanPlayerAckMessage.AdminBanPlayerResult banPlayerResult = 2;
-      private de.pokerth.protocol.ProtoBuf.AdminBanPlayerAckMessage.AdminBanPlayerResult banPlayerResult_ = de.pokerth.protocol.ProtoBuf.AdminBanPlayerAckMessage.AdminBanPlayerResult.banPlayerAccepted;
+      // required bytes compressedData = 2;
+      private com.google.protobuf.ByteString compressedData_ = com.google.protobuf.ByteString.EMPTY;
       /**
-       * <code>required .AdminBanPlayerAckMessage.AdminBanPlayerResult banPlayerResult = 2;</code>
+       * <code>required bytes compressedData = 2;</code>
+       *
+       * <pre>
+       * zlib compressed packets, each with the usual size header.
+       * </pre>
        */
-      public boolean hasBanPlayerResult() {
+      public boolean hasCompressedData() {
         return ((bitField0_ & 0x00000002) == 0x00000002);
       }
       /**
-       * <code>required .AdminBanPlayerAckMessage.AdminBanPlayerResult banPlayerResult = 2;</code>
+       * <code>required bytes compressedData = 2;</code>
+       *
+       * <pre>
+       * zlib compressed packets, each with the usual size header.
+       * </pre>
        */
-      public de.pokerth.protocol.ProtoBuf.AdminBanPlayerAckMessage.AdminBanPlayerResult getBanPlayerResult() {
-        return banPlayerResult_;
+      public com.google.protobuf.ByteString getCompressedData() {
+        return compressedData_;
       }
       /**
-       * <code>required .AdminBanPlayerAckMessage.AdminBanPlayerResult banPlayerResult = 2;</code>
+       * <code>required bytes compressedData = 2;</code>
+       *
+       * <pre>
+       * zlib compressed packets, each with the usual size header.
+       * </pre>
        */
-      public Builder setBanPlayerResult(de.pokerth.protocol.ProtoBuf.AdminBanPlayerAckMessage.AdminBanPlayerResult value) {
+      public Builder setCompressedData(com.google.protobuf.ByteString value) {
         if (value == null) {
-          throw new NullPointerException();
-        }
-        bitField0_ |= 0x00000002;
-        banPlayerResult_ = value;
+    throw new NullPointerException();
+  }
+  bitField0_ |= 0x00000002;
+        compressedData_ = value;
         
         return this;
       }
       /**
-       * <code>required .AdminBanPlayerAckMessage.AdminBanPlayerResult banPlayerResult = 2;</code>
+       * <code>required bytes compressedData = 2;</code>
+       *
+       * <pre>
+       * zlib compressed packets, each with the usual size header.
+       * </pre>
        */
-      public Builder clearBanPlayerResult() {
+      public Builder clearCompressedData() {
         bitField0_ = (bitField0_ & ~0x00000002);
-        banPlayerResult_ = de.pokerth.protocol.ProtoBuf.AdminBanPlayerAckMessage.AdminBanPlayerResult.banPlayerAccepted;
+        compressedData_ = getDefaultInstance().getCompressedData();
         
         return this;
       }
 
-      // @@protoc_insertion_point(builder_scope:AdminBanPlayerAckMessage)
+      // @@protoc_insertion_point(builder_scope:CompressedPacketsMessage)
     }
 
     static {
-      defaultInstance = new AdminBanPlayerAckMessage(true);
+      defaultInstance = new CompressedPacketsMessage(true);
       defaultInstance.initFields();
     }
 
-    // @@protoc_insertion_point(class_scope:AdminBanPlayerAckMessage)
+    // @@protoc_insertion_point(class_scope:CompressedPacketsMessage)
   }
 
   public interface PokerTHMessageOrBuilder
@@ -50613,6 +51952,26 @@ public final class ProtoBuf {
      * <code>optional .GameSpectatorLeftMessage gameSpectatorLeftMessage = 82;</code>
      */
     de.pokerth.protocol.ProtoBuf.GameSpectatorLeftMessage getGameSpectatorLeftMessage();
+
+    // optional .LobbySnapshotMessage lobbySnapshotMessage = 83;
+    /**
+     * <code>optional .LobbySnapshotMessage lobbySnapshotMessage = 83;</code>
+     */
+    boolean hasLobbySnapshotMessage();
+    /**
+     * <code>optional .LobbySnapshotMessage lobbySnapshotMessage = 83;</code>
+     */
+    de.pokerth.protocol.ProtoBuf.LobbySnapshotMessage getLobbySnapshotMessage();
+
+    // optional .CompressedPacketsMessage compressedPacketsMessage = 84;
+    /**
+     * <code>optional .CompressedPacketsMessage compressedPacketsMessage = 84;</code>
+     */
+    boolean hasCompressedPacketsMessage();
+    /**
+     * <code>optional .CompressedPacketsMessage compressedPacketsMessage = 84;</code>
+     */
+    de.pokerth.protocol.ProtoBuf.CompressedPacketsMessage getCompressedPacketsMessage();
   }
   /**
    * Protobuf type {@code PokerTHMessage}
@@ -51721,6 +53080,32 @@ public final class ProtoBuf {
               bitField2_ |= 0x00020000;
               break;
             }
+            case 666: {
+              de.pokerth.protocol.ProtoBuf.LobbySnapshotMessage.Builder subBuilder = null;
+              if (((bitField2_ & 0x00040000) == 0x00040000)) {
+                subBuilder = lobbySnapshotMessage_.toBuilder();
+              }
+              lobbySnapshotMessage_ = input.readMessage(de.pokerth.protocol.ProtoBuf.LobbySnapshotMessage.PARSER, extensionRegistry);
+              if (subBuilder != null) {
+                subBuilder.mergeFrom(lobbySnapshotMessage_);
+                lobbySnapshotMessage_ = subBuilder.buildPartial();
+              }
+              bitField2_ |= 0x00040000;
+              break;
+            }
+            case 674: {
+              de.pokerth.protocol.ProtoBuf.CompressedPacketsMessage.Builder subBuilder = null;
+              if (((bitField2_ & 0x00080000) == 0x00080000)) {
+                subBuilder = compressedPacketsMessage_.toBuilder();
+              }
+              compressedPacketsMessage_ = input.readMessage(de.pokerth.protocol.ProtoBuf.CompressedPacketsMessage.PARSER, extensionRegistry);
+              if (subBuilder != null) {
+                subBuilder.mergeFrom(compressedPacketsMessage_);
+                compressedPacketsMessage_ = subBuilder.buildPartial();
+              }
+              bitField2_ |= 0x00080000;
+              break;
+            }
           }
         }
       } catch (com.google.protobuf.InvalidProtocolBufferException e) {
@@ -52076,6 +53461,14 @@ public final class ProtoBuf {
        * <code>Type_GameSpectatorLeftMessage = 81;</code>
        */
       Type_GameSpectatorLeftMessage(80, 81),
+      /**
+       * <code>Type_LobbySnapshotMessage = 82;</code>
+       */
+      Type_LobbySnapshotMessage(81, 82),
+      /**
+       * <code>Type_CompressedPacketsMessage = 83;</code>
+       */
+      Type_CompressedPacketsMessage(82, 83),
       ;
 
       /**
@@ -52402,6 +53795,14 @@ public final class ProtoBuf {
        * <code>Type_GameSpectatorLeftMessage = 81;</code>
        */
       public static final int Type_GameSpectatorLeftMessage_VALUE = 81;
+      /**
+       * <code>Type_LobbySnapshotMessage = 82;</code>
+       */
+      public static final int Type_LobbySnapshotMessage_VALUE = 82;
+      /**
+       * <code>Type_CompressedPacketsMessage = 83;</code>
+       */
+      public static final int Type_CompressedPacketsMessage_VALUE = 83;
 
 
       public final int getNumber() { return value; }
@@ -52489,6 +53890,8 @@ public final class ProtoBuf {
           case 79: return Type_GameListSpectatorLeftMessage;
           case 80: return Type_GameSpectatorJoinedMessage;
           case 81: return Type_GameSpectatorLeftMessage;
+          case 82: return Type_LobbySnapshotMessage;
+          case 83: return Type_CompressedPacketsMessage;
           default: return null;
         }
       }
@@ -53829,6 +55232,38 @@ public final class ProtoBuf {
       return gameSpectatorLeftMessage_;
     }
 
+    // optional .LobbySnapshotMessage lobbySnapshotMessage = 83;
+    public static final int LOBBYSNAPSHOTMESSAGE_FIELD_NUMBER = 83;
+    private de.pokerth.protocol.ProtoBuf.LobbySnapshotMessage lobbySnapshotMessage_;
+    /**
+     * <code>optional .LobbySnapshotMessage lobbySnapshotMessage = 83;</code>
+     */
+    public boolean hasLobbySnapshotMessage() {
+      return ((bitField2_ & 0x00040000) == 0x00040000);
+    }
+    /**
+     * <code>optional .LobbySnapshotMessage lobbySnapshotMessage = 83;</code>
+     */
+    public de.pokerth.protocol.ProtoBuf.LobbySnapshotMessage getLobbySnapshotMessage() {
+      return lobbySnapshotMessage_;
+    }
+
+    // optional .CompressedPacketsMessage compressedPacketsMessage = 84;
+    public static final int COMPRESSEDPACKETSMESSAGE_FIELD_NUMBER = 84;
+    private de.pokerth.protocol.ProtoBuf.CompressedPacketsMessage compressedPacketsMessage_;
+    /**
+     * <code>optional .CompressedPacketsMessage compressedPacketsMessage = 84;</code>
+     */
+    public boolean hasCompressedPacketsMessage() {
+      return ((bitField2_ & 0x00080000) == 0x00080000);
+    }
+    /**
+     * <code>optional .CompressedPacketsMessage compressedPacketsMessage = 84;</code>
+     */
+    public de.pokerth.protocol.ProtoBuf.CompressedPacketsMessage getCompressedPacketsMessage() {
+      return compressedPacketsMessage_;
+    }
+
     private void initFields() {
       messageType_ = de.pokerth.protocol.ProtoBuf.PokerTHMessage.PokerTHMessageType.Type_AnnounceMessage;
       announceMessage_ = de.pokerth.protocol.ProtoBuf.AnnounceMessage.getDefaultInstance();
@@ -53912,6 +55347,8 @@ public final class ProtoBuf {
       gameListSpectatorLeftMessage_ = de.pokerth.protocol.ProtoBuf.GameListSpectatorLeftMessage.getDefaultInstance();
       gameSpectatorJoinedMessage_ = de.pokerth.protocol.ProtoBuf.GameSpectatorJoinedMessage.getDefaultInstance();
       gameSpectatorLeftMessage_ = de.pokerth.protocol.ProtoBuf.GameSpectatorLeftMessage.getDefaultInstance();
+      lobbySnapshotMessage_ = de.pokerth.protocol.ProtoBuf.LobbySnapshotMessage.getDefaultInstance();
+      compressedPacketsMessage_ = de.pokerth.protocol.ProtoBuf.CompressedPacketsMessage.getDefaultInstance();
     }
     private byte memoizedIsInitialized = -1;
     public final boolean isInitialized() {
@@ -54390,6 +55827,18 @@ public final class ProtoBuf {
           return false;
         }
       }
+      if (hasLobbySnapshotMessage()) {
+        if (!getLobbySnapshotMessage().isInitialized()) {
+          memoizedIsInitialized = 0;
+          return false;
+        }
+      }
+      if (hasCompressedPacketsMessage()) {
+        if (!getCompressedPacketsMessage().isInitialized()) {
+          memoizedIsInitialized = 0;
+          return false;
+        }
+      }
       memoizedIsInitialized = 1;
       return true;
     }
@@ -54643,6 +56092,12 @@ public final class ProtoBuf {
       if (((bitField2_ & 0x00020000) == 0x00020000)) {
         output.writeMessage(82, gameSpectatorLeftMessage_);
       }
+      if (((bitField2_ & 0x00040000) == 0x00040000)) {
+        output.writeMessage(83, lobbySnapshotMessage_);
+      }
+      if (((bitField2_ & 0x00080000) == 0x00080000)) {
+        output.writeMessage(84, compressedPacketsMessage_);
+      }
     }
 
     private int memoizedSerializedSize = -1;
@@ -54979,6 +56434,14 @@ public final class ProtoBuf {
         size += com.google.protobuf.CodedOutputStream
           .computeMessageSize(82, gameSpectatorLeftMessage_);
       }
+      if (((bitField2_ & 0x00040000) == 0x00040000)) {
+        size += com.google.protobuf.CodedOutputStream
+          .computeMessageSize(83, lobbySnapshotMessage_);
+      }
+      if (((bitField2_ & 0x00080000) == 0x00080000)) {
+        size += com.google.protobuf.CodedOutputStream
+          .computeMessageSize(84, compressedPacketsMessage_);
+      }
       memoizedSerializedSize = size;
       return size;
     }
@@ -55234,6 +56697,10 @@ public final class ProtoBuf {
         bitField2_ = (bitField2_ & ~0x00010000);
         gameSpectatorLeftMessage_ = de.pokerth.protocol.ProtoBuf.GameSpectatorLeftMessage.getDefaultInstance();
         bitField2_ = (bitField2_ & ~0x00020000);
+        lobbySnapshotMessage_ = de.pokerth.protocol.ProtoBuf.LobbySnapshotMessage.getDefaultInstance();
+        bitField2_ = (bitField2_ & ~0x00040000);
+        compressedPacketsMessage_ = de.pokerth.protocol.ProtoBuf.CompressedPacketsMessage.getDefaultInstance();
+        bitField2_ = (bitField2_ & ~0x00080000);
         return this;
       }
 
@@ -55589,6 +57056,14 @@ public final class ProtoBuf {
           to_bitField2_ |= 0x00020000;
         }
         result.gameSpectatorLeftMessage_ = gameSpectatorLeftMessage_;
+        if (((from_bitField2_ & 0x00040000) == 0x00040000)) {
+          to_bitField2_ |= 0x00040000;
+        }
+        result.lobbySnapshotMessage_ = lobbySnapshotMessage_;
+        if (((from_bitField2_ & 0x00080000) == 0x00080000)) {
+          to_bitField2_ |= 0x00080000;
+        }
+        result.compressedPacketsMessage_ = compressedPacketsMessage_;
         result.bitField0_ = to_bitField0_;
         result.bitField1_ = to_bitField1_;
         result.bitField2_ = to_bitField2_;
@@ -55843,6 +57318,12 @@ public final class ProtoBuf {
         if (other.hasGameSpectatorLeftMessage()) {
           mergeGameSpectatorLeftMessage(other.getGameSpectatorLeftMessage());
         }
+        if (other.hasLobbySnapshotMessage()) {
+          mergeLobbySnapshotMessage(other.getLobbySnapshotMessage());
+        }
+        if (other.hasCompressedPacketsMessage()) {
+          mergeCompressedPacketsMessage(other.getCompressedPacketsMessage());
+        }
         return this;
       }
 
@@ -56319,6 +57800,18 @@ public final class ProtoBuf {
             return false;
           }
         }
+        if (hasLobbySnapshotMessage()) {
+          if (!getLobbySnapshotMessage().isInitialized()) {
+            
+            return false;
+          }
+        }
+        if (hasCompressedPacketsMessage()) {
+          if (!getCompressedPacketsMessage().isInitialized()) {
+            
+            return false;
+          }
+        }
         return true;
       }
 
@@ -61320,6 +62813,128 @@ public final class ProtoBuf {
         return this;
       }
 
+      // optional .LobbySnapshotMessage lobbySnapshotMessage = 83;
+      private de.pokerth.protocol.ProtoBuf.LobbySnapshotMessage lobbySnapshotMessage_ = de.pokerth.protocol.ProtoBuf.LobbySnapshotMessage.getDefaultInstance();
+      /**
+       * <code>optional .LobbySnapshotMessage lobbySnapshotMessage = 83;</code>
+       */
+      public boolean hasLobbySnapshotMessage() {
+        return ((bitField2_ & 0x00040000) == 0x00040000);
+      }
+      /**
+       * <code>optional .LobbySnapshotMessage lobbySnapshotMessage = 83;</code>
+       */
+      public de.pokerth.protocol.ProtoBuf.LobbySnapshotMessage getLobbySnapshotMessage() {
+        return lobbySnapshotMessage_;
+      }
+      /**
+       * <code>optional .LobbySnapshotMessage lobbySnapshotMessage = 83;</code>
+       */
+      public Builder setLobbySnapshotMessage(de.pokerth.protocol.ProtoBuf.LobbySnapshotMessage value) {
+        if (value == null) {
+          throw new NullPointerException();
+        }
+        lobbySnapshotMessage_ = value;
+
+        bitField2_ |= 0x00040000;
+        return this;
+      }
+      /**
+       * <code>optional .LobbySnapshotMessage lobbySnapshotMessage = 83;</code>
+       */
+      public Builder setLobbySnapshotMessage(
+          de.pokerth.protocol.ProtoBuf.LobbySnapshotMessage.Builder builderForValue) {
+        lobbySnapshotMessage_ = builderForValue.build();
+
+        bitField2_ |= 0x00040000;
+        return this;
+      }
+      /**
+       * <code>optional .LobbySnapshotMessage lobbySnapshotMessage = 83;</code>
+       */
+      public Builder mergeLobbySnapshotMessage(de.pokerth.protocol.ProtoBuf.LobbySnapshotMessage value) {
+        if (((bitField2_ & 0x00040000) == 0x00040000) &&
+            lobbySnapshotMessage_ != de.pokerth.protocol.ProtoBuf.LobbySnapshotMessage.getDefaultInstance()) {
+          lobbySnapshotMessage_ =
+            de.pokerth.protocol.ProtoBuf.LobbySnapshotMessage.newBuilder(lobbySnapshotMessage_).mergeFrom(value).buildPartial();
+        } else {
+          lobbySnapshotMessage_ = value;
+        }
+
+        bitField2_ |= 0x00040000;
+        return this;
+      }
+      /**
+       * <code>optional .LobbySnapshotMessage lobbySnapshotMessage = 83;</code>
+       */
+      public Builder clearLobbySnapshotMessage() {
+        lobbySnapshotMessage_ = de.pokerth.protocol.ProtoBuf.LobbySnapshotMessage.getDefaultInstance();
+
+        bitField2_ = (bitField2_ & ~0x00040000);
+        return this;
+      }
+
+      // optional .CompressedPacketsMessage compressedPacketsMessage = 84;
+      private de.pokerth.protocol.ProtoBuf.CompressedPacketsMessage compressedPacketsMessage_ = de.pokerth.protocol.ProtoBuf.CompressedPacketsMessage.getDefaultInstance();
+      /**
+       * <code>optional .CompressedPacketsMessage compressedPacketsMessage = 84;</code>
+       */
+      public boolean hasCompressedPacketsMessage() {
+        return ((bitField2_ & 0x00080000) == 0x00080000);
+      }
+      /**
+       * <code>optional .CompressedPacketsMessage compressedPacketsMessage = 84;</code>
+       */
+      public de.pokerth.protocol.ProtoBuf.CompressedPacketsMessage getCompressedPacketsMessage() {
+        return compressedPacketsMessage_;
+      }
+      /**
+       * <code>optional .CompressedPacketsMessage compressedPacketsMessage = 84;</code>
+       */
+      public Builder setCompressedPacketsMessage(de.pokerth.protocol.ProtoBuf.CompressedPacketsMessage value) {
+        if (value == null) {
+          throw new NullPointerException();
+        }
+        compressedPacketsMessage_ = value;
+
+        bitField2_ |= 0x00080000;
+        return this;
+      }
+      /**
+       * <code>optional .CompressedPacketsMessage compressedPacketsMessage = 84;</code>
+       */
+      public Builder setCompressedPacketsMessage(
+          de.pokerth.protocol.ProtoBuf.CompressedPacketsMessage.Builder builderForValue) {
+        compressedPacketsMessage_ = builderForValue.build();
+
+        bitField2_ |= 0x00080000;
+        return this;
+      }
+      /**
+       * <code>optional .CompressedPacketsMessage compressedPacketsMessage = 84;</code>
+       */
+      public Builder mergeCompressedPacketsMessage(de.pokerth.protocol.ProtoBuf.CompressedPacketsMessage value) {
+        if (((bitField2_ & 0x00080000) == 0x00080000) &&
+            compressedPacketsMessage_ != de.pokerth.protocol.ProtoBuf.CompressedPacketsMessage.getDefaultInstance()) {
+          compressedPacketsMessage_ =
+            de.pokerth.protocol.ProtoBuf.CompressedPacketsMessage.newBuilder(compressedPacketsMessage_).mergeFrom(value).buildPartial();
+        } else {
+          compressedPacketsMessage_ = value;
+        }
+
+        bitField2_ |= 0x00080000;
+        return this;
+      }
+      /**
+       * <code>optional .CompressedPacketsMessage compressedPacketsMessage = 84;</code>
+       */
+      public Builder clearCompressedPacketsMessage() {
+        compressedPacketsMessage_ = de.pokerth.protocol.ProtoBuf.CompressedPacketsMessage.getDefaultInstance();
+
+        bitField2_ = (bitField2_ & ~0x00080000);
+        return this;
+      }
+
       // @@protoc_insertion_point(builder_scope:PokerTHMessage)
     }
 